@@ -1,11 +1,23 @@
 /**
  *******************************************************************************
  * @file        PPP_NetworkDriver.ino
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Main source-file.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Initialization of the DataBuffer-pools. (MS)
+ *                      -# Initialization and loop of the event-log. (MS)
+ *                      -# The state is reported by a String in the
+ *                         program-memory. (MS)
+ *                      -# Initialization and loop of the console shell. (MS)
+ *                      -# Initialization of the time-base and the
+ *                         frame-capture. (MS)
+ *                      -# The modules are called by the scheduler, the
+ *                         LCP-sequence waits by a timer instead of
+ *                         _delay_ms. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# No typedefs for struct and enum. (MS)
  *                      -# Simple state-machine for testing. (MS)
@@ -49,7 +61,13 @@
 
 #include <util/delay.h>
 
+#include "utils\\databuffer.h"
 #include "utils\\serialConsole.h"
+#include "utils\\eventLog.h"
+#include "utils\\shell.h"
+#include "utils\\timebase.h"
+#include "utils\\capture.h"
+#include "utils\\scheduler.h"
 #include "driver\\net\\PPP.h"
 #include "driver\\net\\LCP.h"
 #include "driver\\net\\IPV4.h"
@@ -79,13 +97,26 @@ struct databuffer_basic_t dbFirstPacket;
 
 enum PPPinitState_e {
         PPP_INIT_STATE_CONFIGURING_CLIENT,
+        PPP_INIT_STATE_WAITING_FOR_SERVER,
         PPP_INIT_STATE_CONFIGURING_SERVER,
         PPP_INIT_STATE_AUTHENTICATE,
 };
 static enum PPPinitState_e PPPinitState;
 
+// private function prototypes
+static void onPPPRx(void);
+static void onPPPTx(void);
+static void onLCPTimer(void);
+static void onTick(void);
+static void updatePPPinitState(void);
+
 void setup() {
+          databuffer_init();
           serialConsole_init();
+          eventLog_init();
+          shell_init();
+          timebase_init();
+          capture_init();
 
           net_PPP_init();
           net_LCP_init();
@@ -102,30 +133,75 @@ void setup() {
           //net_PPP_txDataBuffer(NETPPP_LCP, &dbFirstPacket);
 
           _delay_ms(100);
+
+          // the scheduler starts after the delays, a frame that has been
+          // received meanwhile is processed by the first tick
+          scheduler_init();
+          scheduler_setHandler(SCHEDULER_EVENT_PPP_RX, onPPPRx);
+          scheduler_setHandler(SCHEDULER_EVENT_PPP_TX, onPPPTx);
+          scheduler_setHandler(SCHEDULER_EVENT_LCP_TIMER, onLCPTimer);
+          scheduler_setHandler(SCHEDULER_EVENT_TICK, onTick);
 }
 
 void loop() {
-          // check for received packets and process them
+          // dispatch the events of the interrupts or sleep until the next one
+          scheduler_run();
+}
+
+static void onPPPRx(void) {
+          // process the received packets
+          net_PPP_loop();
+          updatePPPinitState();
+}
+
+static void onPPPTx(void) {
+          updatePPPinitState();
+}
+
+static void onLCPTimer(void) {
+          // a frame in progress would drop the Configure-Request
+          if (!net_PPP_txIsBusy()) {
+                  net_LCP_startConfigurationOfHost();
+                  if (net_PPP_txIsBusy()) {
+                          PPPinitState = PPP_INIT_STATE_CONFIGURING_SERVER;
+                          return;
+                  }
+          }
+          // not sent, try again
+          scheduler_postDelayed(SCHEDULER_EVENT_LCP_TIMER, 10);
+}
+
+static void onTick(void) {
+          // continue the flow-control and the baudrate detection
           net_PPP_loop();
 
+          // transmit the recorded events over the serial console
+          eventLog_loop();
+
+          // execute the commands of the console shell
+          shell_loop();
+}
+
+static void updatePPPinitState(void) {
           switch (PPPinitState) {
           case PPP_INIT_STATE_CONFIGURING_CLIENT:
                   if ((net_PPP_getState() == PPPState_Establish) &&
                       (net_LCP_getState() & NET_LCP_STATE__CLIENT_CONFIGURED) && 
                       !net_PPP_txIsBusy()) {
-                          _delay_ms(10);
-                          net_PPP_loop();
-                          _delay_ms(10);
-                          net_LCP_startConfigurationOfHost();
-                          PPPinitState = PPP_INIT_STATE_CONFIGURING_SERVER;
+                          // the remote side processes the Configure-Ack
+                          // first, the received frames are handled meanwhile
+                          scheduler_postDelayed(SCHEDULER_EVENT_LCP_TIMER, 20);
+                          PPPinitState = PPP_INIT_STATE_WAITING_FOR_SERVER;
                   }
                   break;
+          case PPP_INIT_STATE_WAITING_FOR_SERVER:
+                  break;
           case PPP_INIT_STATE_CONFIGURING_SERVER:
                   /*if ((net_LCP_getState() & NET_LCP_STATE__HOST_CONFIGURED) && 
                       !net_PPP_txIsBusy()) {
                           net_PPP_setState(PPPState_Authenticate);
                           PPPinitState = PPP_INIT_STATE_AUTHENTICATE;
-                          serialConsole_txString("PPPState_Authenticate\n");
+                          serialConsole_txLiteralP("PPPState_Authenticate\n");
                   }*/
                   break;
           case PPP_INIT_STATE_AUTHENTICATE:
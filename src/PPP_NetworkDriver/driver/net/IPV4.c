@@ -1,13 +1,24 @@
 /**
  *******************************************************************************
  * @file        IPV4.c
- * @version     0.0.2
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Source file of the IPV4-Protocol-Stack.
  *              This module implements the IPV4-Protocol-Stack for the
  *              Internet-Layer of the OSI-Model.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# The header is parsed with a databuffer-cursor,
+ *                         the payload is passed as a clone. (MS)
+ *                      -# The header-checksum is verified. (MS)
+ *                      -# The debug-output is recorded by the event-log.
+ *                         (MS)
+ *                      -# The events are filtered by NET_IPV4_LOG_LEVEL.
+ *                         (MS)
+ *                      -# Added net_IPV4_getLocalIP, net_IPV4_getStatistics
+ *                         and net_IPV4_resetStatistics. (MS)
+ *
  * @since       V0.0.2, 2017.09.25:
  *                      -# Corrected Indentiation (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -50,7 +61,12 @@
 #include "..\\..\\system.h"
 #include "ipv4_common.h"
 #include "..\\..\\utils\\databuffer.h"
-#include "..\\..\\utils\\serialConsole.h"
+#include "..\\..\\utils\\eventLog.h"
+
+#include <string.h>
+
+#define EVENTLOG_MODULE_LEVEL NET_IPV4_LOG_LEVEL
+#include "..\\..\\utils\\eventLog_level.h"
 
 #undef NET_IPV4_DATALINK_FILENAME
 #define NET_IPV4_DATALINK_FILENAME \
@@ -64,6 +80,9 @@
 #define net_IPV4_datalink_setIPRxCallback \
         CONCAT2(NET_IPV4_DATALINK_FUNPREFIX, _setIPRxCallback)
 
+#define NET_IPV4_HEADER_LENGTH_MIN      (20)
+#define NET_IPV4_HEADER_LENGTH_MAX      (60)
+
 
 // type-definitions
 
@@ -71,6 +90,7 @@
 // private function prototypes
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer);
 static void rxCallback_DUMMY(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP);
+static uint16_t calculateChecksum(const uint8_t *data, uint8_t length);
 
 // private data
 // RX-Callback-Functions
@@ -79,6 +99,7 @@ static void (*rxCallback_UDP)(struct databuffer_basic_t *rxDataBuffer, ipv4_t so
 static void (*rxCallback_TCP)(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP) =
         rxCallback_DUMMY;
 static ipv4_t localIP;
+static struct net_IPV4_statistics_t statistics;
 
 // public functions
 void net_IPV4_init(void)
@@ -87,6 +108,8 @@ void net_IPV4_init(void)
 
         uint8_t ip[4] = {NET_IPV4_IP_DEFAULT};
         localIP = IPV4_create(ip);
+        
+        net_IPV4_resetStatistics();
 }
 
 void net_IPV4_setLocalIP(uint8_t ip[4])
@@ -94,6 +117,21 @@ void net_IPV4_setLocalIP(uint8_t ip[4])
         localIP = IPV4_create(ip);
 }
 
+ipv4_t net_IPV4_getLocalIP(void)
+{
+        return localIP;
+}
+
+void net_IPV4_getStatistics(struct net_IPV4_statistics_t *statisticsCopy)
+{
+        *statisticsCopy = statistics;
+}
+
+void net_IPV4_resetStatistics(void)
+{
+        memset(&statistics, 0, sizeof(statistics));
+}
+
 void net_IPV4_setUDPRxCallback(void (*rxCallback)(struct databuffer_basic_t *rxDataBuffer,
                                                   ipv4_t sourceIP))
 {
@@ -112,68 +150,118 @@ void net_IPV4_setTCPRxCallback(void (*rxCallback)(struct databuffer_basic_t *rxD
 // private functions
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer)
 {
-        static struct databuffer_basic_t rxDataBufferPayload;
-        
+        struct databuffer_cursor_t cursor;
+        struct databuffer_basic_t *rxDataBufferPayload;
+        uint8_t headerBuffer[NET_IPV4_HEADER_LENGTH_MAX];
+        uint8_t *header;
         ipv4_t sourceIP;
-        ipv4_header_t *ipHeader = (ipv4_header_t *)&rxDataBuffer->data[0];
+        ipv4_t destinationIP;
+        uint8_t versionAndIHL;
+        uint8_t protocol;
+        uint16_t totalLength;
+        uint8_t payloadOffset;
+
+        // read the header, it may span several segments
+        databuffer_cursor_init(&cursor, rxDataBuffer, 0);
+        if (!databuffer_cursor_readU8(&cursor, &versionAndIHL) ||
+            !databuffer_cursor_skip(&cursor, 1) ||
+            !databuffer_cursor_readU16(&cursor, &totalLength) ||
+            !databuffer_cursor_skip(&cursor, 5) ||
+            !databuffer_cursor_readU8(&cursor, &protocol) ||
+            !databuffer_cursor_skip(&cursor, 2) ||
+            !databuffer_cursor_read(&cursor, sourceIP.single, 4) ||
+            !databuffer_cursor_read(&cursor, destinationIP.single, 4))
+                return;
 
         // check version
-        if (IPV4_header_getVersion(ipHeader) == 4) {
+        if ((versionAndIHL >> 4) == 4) {
                 // check destination IP
-                if (IPV4_header_getDestinationIPAddress(ipHeader).raw == localIP.raw)  {
-                        sourceIP = IPV4_header_getSourceIPAddress(ipHeader);
+                if (destinationIP.raw == localIP.raw)  {
+                        payloadOffset = (versionAndIHL & 0x0F) * 4;
+                        if ((payloadOffset < NET_IPV4_HEADER_LENGTH_MIN) ||
+                            (payloadOffset > totalLength) ||
+                            (totalLength > databuffer_getTotalLength(rxDataBuffer))) {
+                                statistics.rxHeaderErrors++;
+                                return;
+                        }
 
-                        uint8_t payloadOffset = IPV4_header_getIHL(ipHeader) * 4;
-                        uint16_t payloadLength = IPV4_header_getTotalLength(ipHeader)
-                                                 - payloadOffset;
+                        // the checksum needs the whole header in one piece
+                        header = databuffer_linearize(rxDataBuffer,
+                                                      payloadOffset,
+                                                      headerBuffer);
+                        if ((header == NULL) ||
+                            (calculateChecksum(header, payloadOffset) != 0xFFFF)) {
+                                statistics.rxChecksumErrors++;
+                                EVENTLOG_WARNING(eventLog_writeEvent(
+                                        EVENTLOG_IPV4_CHECKSUM_INVALID));
+                                return;
+                        }
 
-                        databuffer_create(&rxDataBufferPayload,
-                                          &rxDataBuffer->data[payloadOffset],
-                                          payloadLength);
+                        rxDataBufferPayload =
+                                databuffer_clone_partial(rxDataBuffer,
+                                                         payloadOffset,
+                                                         totalLength
+                                                         - payloadOffset);
+                        if (rxDataBufferPayload == NULL)
+                                return;
 
-                        switch (IPV4_header_getProtocol(ipHeader)) {
+                        statistics.rxPackets++;
+                        switch (protocol) {
                         case IP_PROTOCOL_UDP:
-                                rxCallback_UDP(&rxDataBufferPayload,
+                                rxCallback_UDP(rxDataBufferPayload,
                                                sourceIP);
                                 break;
                                 
                         case IP_PROTOCOL_TCP:
-                                rxCallback_TCP(&rxDataBufferPayload,
+                                rxCallback_TCP(rxDataBufferPayload,
                                                sourceIP);
                                 break;
                                 
                         default:
-                                rxCallback_DUMMY(&rxDataBufferPayload,
+                                statistics.rxUnknownProtocol++;
+                                rxCallback_DUMMY(rxDataBufferPayload,
                                                  sourceIP);
                                 break;
                         }
+
+                        databuffer_free(rxDataBufferPayload);
                 } else {
-                        serialConsole_txString("not my IP\n");
+                        statistics.rxNotMyIP++;
+                        EVENTLOG_DEBUG(eventLog_writeEvent(EVENTLOG_IPV4_NOT_MY_IP));
                 }
         } else {
-                serialConsole_txString("IP.version != 4\n");
+                statistics.rxHeaderErrors++;
+                EVENTLOG_WARNING(eventLog_writeEvent(
+                        EVENTLOG_IPV4_VERSION_INVALID));
         }
 }
 
 static void rxCallback_DUMMY(struct databuffer_basic_t *rxDataBuffer,
                              ipv4_t sourceIP)
 {
-        char singleNumber[4];
-        serialConsole_txString("\n\nrecv_IP_?[");
-        itoa(IPV4_getSingle(sourceIP, 0), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 1), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 2), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 3), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString("] = \'");
-        serialConsole_txDatabuffer(rxDataBuffer);
-        serialConsole_txString("\'\n\n");
+        EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_IPV4_RX_UNKNOWN,
+                                           sourceIP.single,
+                                           sizeof(sourceIP.single),
+                                           rxDataBuffer));
+}
+
+static uint16_t calculateChecksum(const uint8_t *data, uint8_t length)
+{
+        uint32_t sum = 0;
+
+        // one's complement sum of all 16-Bit-words
+        while (length > 1) {
+                sum += ((uint16_t)data[0] << 8) | ((uint16_t)data[1] << 0);
+                data += 2;
+                length -= 2;
+        }
+        if (length > 0)
+                sum += (uint16_t)data[0] << 8;
+
+        while (sum >> 16)
+                sum = (sum & 0x0000FFFF) + (sum >> 16);
+
+        return (uint16_t)sum;
 }
 
 
@@ -1,13 +1,17 @@
 /**
  *******************************************************************************
  * @file        IPV4.h
- * @version     0.0.2
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Header file of the IPV4-Protocol-Stack.
  *              This module implements the IPV4-Protocol-Stack for the
  *              Internet-Layer of the OSI-Model.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added net_IPV4_getLocalIP, net_IPV4_getStatistics
+ *                         and net_IPV4_resetStatistics. (MS)
+ *
  * @since       V0.0.2, 2017.09.25:
  *                      -# No typedefs for struct and enum. (MS)
  *
@@ -63,6 +67,37 @@ enum ipv4_protocol_e {
         IP_PROTOCOL_TCP = 0x06
 };
 
+/**
+ *  This structure holds a snapshot of the counters of the IPV4-Module.
+ */
+struct net_IPV4_statistics_t {
+        /**
+         * Number of received packets that had been passed to UDP, TCP or
+         * the unknown protocol handler.
+         */
+        uint16_t                        rxPackets;
+
+        /**
+         * Number of received packets with an invalid header-checksum.
+         */
+        uint16_t                        rxChecksumErrors;
+
+        /**
+         * Number of received packets with a foreign destination IP-address.
+         */
+        uint16_t                        rxNotMyIP;
+
+        /**
+         * Number of received packets with an invalid version or header.
+         */
+        uint16_t                        rxHeaderErrors;
+
+        /**
+         * Number of received packets with an unknown protocol.
+         */
+        uint16_t                        rxUnknownProtocol;
+};
+
 /**
  *  Initializes the IPV4-Protocol-Stack on the Internet-Layer and the
  *  correspondig Data-Link-Layer-Module.
@@ -82,6 +117,31 @@ void net_IPV4_init(void);
  */
 void net_IPV4_setLocalIP(uint8_t ip[4]);
 
+/**
+ *  Returns the local IP-address.
+ *  @return     Local IP-address.
+ *  @pre        net_IP_init has been called.
+ *  @post       None.
+ */
+ipv4_t net_IPV4_getLocalIP(void);
+
+/**
+ *  Copies the counters of the IPV4-Module.
+ *  @param      statistics: Buffer that will hold the counters.
+ *  @return     None.
+ *  @pre        net_IPV4_init has been called.
+ *  @post       None.
+ */
+void net_IPV4_getStatistics(struct net_IPV4_statistics_t *statistics);
+
+/**
+ *  Sets the counters of the IPV4-Module to 0.
+ *  @return     None.
+ *  @pre        net_IPV4_init has been called.
+ *  @post       None.
+ */
+void net_IPV4_resetStatistics(void);
+
 /**
  *  Sets the function that will be called when a new UDP-packet has been
  *  received.
@@ -1,11 +1,14 @@
 /**
  *******************************************************************************
  * @file        IPV4_cfg.h
- * @version     1.0
- * @date        2016.06.28
+ * @version     1.1
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Config file of the IPV4-Protocol-Stack.
  *
+ * @since       V1.1, 2026.10.19:
+ *              -# Added NET_IPV4_LOG_LEVEL. (MS)
+ *
  * @since       V1.0, 2016.06.28:
  *              -# Initiale Version (MS)
  *
@@ -58,4 +61,16 @@
  */
 #define NET_IPV4_IP_DEFAULT             192, 168, 1, 2
 
+/**
+ *  Log-level of the module (see eventLog.h). The events of the higher levels
+ *  are removed by the compiler.                                              @n
+ *  Possible values are:                                                      @n
+ *  EVENTLOG_LEVEL_NONE                                                       @n
+ *  EVENTLOG_LEVEL_ERROR                                                      @n
+ *  EVENTLOG_LEVEL_WARNING                                                    @n
+ *  EVENTLOG_LEVEL_INFO                                                       @n
+ *  EVENTLOG_LEVEL_DEBUG
+ */
+#define NET_IPV4_LOG_LEVEL              EVENTLOG_LEVEL_DEBUG
+
 #endif /* _NET_IPV4_CFG_H_ */
@@ -2,12 +2,32 @@
 
 /**
  *******************************************************************************
- * @file        LCP.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @file        LCP.cpp
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Source file of the LCP-Protocol-Stack.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Messages are built in pool-buffers and the header
+ *                         is prepended in place. (MS)
+ *                      -# Headers and options are parsed with a
+ *                         databuffer-cursor. (MS)
+ *                      -# The constant options are sent from the
+ *                         program-memory. (MS)
+ *                      -# The debug-output is recorded by the event-log.
+ *                         (MS)
+ *                      -# The events are filtered by NET_LCP_LOG_LEVEL.
+ *                         (MS)
+ *                      -# Added net_LCP_setMru, net_LCP_getMru and
+ *                         net_LCP_sendEchoRequest, the MRU is sent from the
+ *                         RAM. (MS)
+ *                      -# Echo-Requests of the peer are answered. (MS)
+ *                      -# Added net_LCP_getStatistics and
+ *                         net_LCP_resetStatistics. (MS)
+ *                      -# Compiled as C++, the Echo-Request is owned by a
+ *                         DataBufferChain. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Added handling of incomming LCP-Options for
  *                         configuration. (MS)
@@ -53,8 +73,13 @@
 #include "LCP_cfg.h"
 
 #include "..\\..\\system.h"
-#include "..\\..\\utils\\databuffer.h"
-#include "..\\..\\utils\\serialConsole.h"
+#include "..\\..\\utils\\databuffer.hpp"
+#include "..\\..\\utils\\eventLog.h"
+
+#include <string.h>
+
+#define EVENTLOG_MODULE_LEVEL NET_LCP_LOG_LEVEL
+#include "..\\..\\utils\\eventLog_level.h"
 
 #undef NET_LPC_DATALINK_FILENAME
 #define NET_LPC_DATALINK_FILENAME \
@@ -79,6 +104,8 @@
         
 
 #define NET_LCP_HEADER_LENGTH               (4)
+#define NET_LCP_STATE__OPENED                   \
+        (NET_LCP_STATE__HOST_CONFIGURED | NET_LCP_STATE__CLIENT_CONFIGURED)
 
 // type-definitions
 enum net_LCP_code_e {
@@ -120,7 +147,7 @@ enum net_LCP_option_e {
 
 // private function prototypes
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer);
-static void sendMessage(enum net_LCP_code_e code,
+static bool sendMessage(enum net_LCP_code_e code,
                         uint8_t identifier,
                         struct databuffer_basic_t *data);
 static void handleConfigureRequest(uint8_t identifier,
@@ -134,31 +161,36 @@ static void handleConfigureReject(uint8_t identifier,
 static bool checkConfigureRequest(enum net_LCP_code_e mode,
                                   uint8_t identifier,
                                   struct databuffer_basic_t *rxOptions);
+static void handleEchoRequest(uint8_t identifier,
+                              struct databuffer_basic_t *rxData);
 #define net_LCP_getMagicNumber()        \
         (~peerMagicNumber)
 
 // private data
-static uint8_t txDataHeader[NET_LCP_HEADER_LENGTH];
-static struct databuffer_basic_t txDataBufferHeader;
-static uint8_t txData[64];
-static struct databuffer_basic_t txDataBuffer;
-static struct databuffer_basic_t txOptionResponse;
+// options of the configure-request that never change (ACCM)
+static const uint8_t constantOptions[LCP_OPTION_LENGTH_ACCM] PROGMEM = {
+        LCP_OPTION_ACCM, LCP_OPTION_LENGTH_ACCM, 0x00, 0x00, 0x00, 0x00
+};
 static uint32_t peerMagicNumber;
 static uint8_t state;
 static uint8_t rxIdentifier;
+static uint16_t mru;
+static uint8_t echoIdentifier;
+static struct net_LCP_statistics_t statistics;
 
 // public functions
 void net_LCP_init(void)
 {
         net_LCP_datalink_setIPRxCallback(rxCallback);
 
-        databuffer_create(&txDataBuffer,
-                          txData,
-                          64);
         peerMagicNumber = 0xCAFEBABE;
         
         rxIdentifier = 0;
         state = 0;
+        mru = net_LCP_datalink_maxMTU();
+        echoIdentifier = 0;
+        
+        net_LCP_resetStatistics();
 }
 
 uint8_t net_LCP_getState(void)
@@ -168,11 +200,24 @@ uint8_t net_LCP_getState(void)
 
 void net_LCP_startConfigurationOfHost(void)
 {
-        struct net_LCP_Option_t *option = (struct net_LCP_Option_t *)txDataBuffer.data;
-        txDataBuffer.length = 0;
+        struct databuffer_basic_t *options;
+        struct databuffer_basic_t *optionsP;
+        struct net_LCP_Option_t *option;
+
+        options = databuffer_allocWithHeadroom(NET_LCP_HEADER_LENGTH,
+                                               LCP_OPTION_LENGTH_MagicNumber +
+                                               LCP_OPTION_LENGTH_MRU);
+        optionsP = databuffer_allocP(constantOptions, sizeof(constantOptions));
+        if ((options == NULL) || (optionsP == NULL)) {
+                databuffer_free(options);
+                databuffer_free(optionsP);
+                return;
+        }
         
         // create the configuration-data
         //  magic-number
+        option = (struct net_LCP_Option_t *)
+                 databuffer_put(options, LCP_OPTION_LENGTH_MagicNumber);
         option->type    = LCP_OPTION_MagicNumber;
         option->length  = LCP_OPTION_LENGTH_MagicNumber;
         option->data[0] = (uint8_t)((net_LCP_getMagicNumber() >> 24)
@@ -183,142 +228,208 @@ void net_LCP_startConfigurationOfHost(void)
                                     & 0x000000FF);
         option->data[3] = (uint8_t)((net_LCP_getMagicNumber() >>  0)
                                     & 0x000000FF);
-        txDataBuffer.length += option->length;
-        option = (struct net_LCP_Option_t *)(txDataBuffer.data
-                                             + txDataBuffer.length);
-        
-        //  ACCM
-        option->type    = LCP_OPTION_ACCM;
-        option->length  = LCP_OPTION_LENGTH_ACCM;
-        option->data[0] = 0x00;
-        option->data[1] = 0x00;
-        option->data[2] = 0x00;
-        option->data[3] = 0x00;
-        txDataBuffer.length += option->length;
-        option = (struct net_LCP_Option_t *)(txDataBuffer.data
-                                             + txDataBuffer.length);
-        
         //  MRU
+        option = (struct net_LCP_Option_t *)
+                 databuffer_put(options, LCP_OPTION_LENGTH_MRU);
         option->type    = LCP_OPTION_MRU;
         option->length  = LCP_OPTION_LENGTH_MRU;
-        option->data[0] = (uint8_t)((net_LCP_datalink_maxMTU() >> 8) & 0x00FF);
-        option->data[1] = (uint8_t)((net_LCP_datalink_maxMTU() >> 0) & 0x00FF);
-        txDataBuffer.length += option->length;
-        option = (struct net_LCP_Option_t *)(txDataBuffer.data
-                                             + txDataBuffer.length);
+        option->data[0] = (uint8_t)((mru >> 8) & 0x00FF);
+        option->data[1] = (uint8_t)((mru >> 0) & 0x00FF);
+        
+        //  ACCM is sent directly from the program-memory
+        databuffer_insertAtEnd(options, optionsP);
         
         // send the configuration-data
-        txDataBuffer.tot_length = txDataBuffer.length;
-        sendMessage(LCP_ConfigureRequest, rxIdentifier, &txDataBuffer);
+        sendMessage(LCP_ConfigureRequest, rxIdentifier, options);
+        databuffer_free(options);
+}
+
+bool net_LCP_setMru(uint16_t newMru)
+{
+        if ((newMru < NET_LCP_MRU_MIN) || (newMru > net_LCP_datalink_maxMTU()))
+                return false;
+        
+        mru = newMru;
+        return true;
+}
+
+uint16_t net_LCP_getMru(void)
+{
+        return mru;
+}
+
+bool net_LCP_sendEchoRequest(void)
+{
+        uint32_t magicNumber = net_LCP_getMagicNumber();
+        uint8_t *magic;
+        
+        if ((state & NET_LCP_STATE__OPENED) != NET_LCP_STATE__OPENED)
+                return false;
+        
+        // the request is released when data goes out of scope
+        DataBufferChain data =
+                DataBufferChain::allocWithHeadroom(NET_LCP_HEADER_LENGTH,
+                                                   sizeof(magicNumber));
+        if (!data)
+                return false;
+        
+        // the data of the request is the own magic-number
+        magic = databuffer_put(data.get(), sizeof(magicNumber));
+        magic[0] = (uint8_t)((magicNumber >> 24) & 0x000000FF);
+        magic[1] = (uint8_t)((magicNumber >> 16) & 0x000000FF);
+        magic[2] = (uint8_t)((magicNumber >>  8) & 0x000000FF);
+        magic[3] = (uint8_t)((magicNumber >>  0) & 0x000000FF);
+        
+        if (!sendMessage(LCP_EchoRequest, ++echoIdentifier, data.get()))
+                return false;
+        
+        statistics.echoRequestsSent++;
+        return true;
+}
+
+void net_LCP_getStatistics(struct net_LCP_statistics_t *statisticsCopy)
+{
+        *statisticsCopy = statistics;
+}
+
+void net_LCP_resetStatistics(void)
+{
+        memset(&statistics, 0, sizeof(statistics));
 }
 
 
 // private functions
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer)
 {
-        uint8_t identifier = rxDataBuffer->data[1];
-        uint16_t length = (((uint16_t)rxDataBuffer->data[2] << 8) |
-                           ((uint16_t)rxDataBuffer->data[3] << 0))
-                          - NET_LCP_HEADER_LENGTH;
-
-        databuffer_copy_partial(&txDataBuffer,
-                                0,
-                                rxDataBuffer,
-                                NET_LCP_HEADER_LENGTH,
-                                length);
-        txDataBuffer.tot_length = length;
-        txDataBuffer.length = length;
-
-        switch ((enum net_LCP_code_e)rxDataBuffer->data[0]) {
+        struct databuffer_cursor_t cursor;
+        struct databuffer_basic_t *options;
+        uint8_t code;
+        uint8_t identifier;
+        uint16_t length;
+
+        // read the header, it may span several segments
+        databuffer_cursor_init(&cursor, rxDataBuffer, 0);
+        if (!databuffer_cursor_readU8(&cursor, &code) ||
+            !databuffer_cursor_readU8(&cursor, &identifier) ||
+            !databuffer_cursor_readU16(&cursor, &length) ||
+            (length < NET_LCP_HEADER_LENGTH))
+                return;
+        length -= NET_LCP_HEADER_LENGTH;
+        if (length > databuffer_cursor_getRemaining(&cursor))
+                return;
+
+        // copy the options into a buffer that can hold the response-header
+        options = databuffer_allocWithHeadroom(NET_LCP_HEADER_LENGTH, length);
+        if (options == NULL)
+                return;
+        databuffer_cursor_read(&cursor,
+                               databuffer_put(options, length),
+                               length);
+        statistics.rxMessages++;
+
+        switch ((enum net_LCP_code_e)code) {
         case LCP_ConfigureRequest:
-                serialConsole_txString("\nLCP_ConfigureRequest:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_CONFIGURE_REQUEST,
+                                                   NULL, 0, options));
                   
-                handleConfigureRequest(identifier, &txDataBuffer);
+                handleConfigureRequest(identifier, options);
                 break;
 
         case LCP_ConfigureAck:
-                serialConsole_txString("\nLCP_ConfigureAck:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_CONFIGURE_ACK,
+                                                   NULL, 0, options));
                   
-                handleConfigureAck(identifier, &txDataBuffer);
+                handleConfigureAck(identifier, options);
                 break;
 
         case LCP_ConfigureNak:
-                serialConsole_txString("\nLCP_ConfigureNak:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_CONFIGURE_NAK,
+                                                   NULL, 0, options));
                   
-                handleConfigureNak(identifier, &txDataBuffer);
+                handleConfigureNak(identifier, options);
                 break;
 
         case LCP_ConfigureReject:
-                serialConsole_txString("\nLCP_ConfigureReject:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_CONFIGURE_REJECT,
+                                                   NULL, 0, options));
                   
-                handleConfigureReject(identifier, &txDataBuffer);
+                handleConfigureReject(identifier, options);
                 break;
 
         case LCP_TerminateRequest:
-                serialConsole_txString("\nTerminateRequest:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_TERMINATE_REQUEST,
+                                                   NULL, 0, options));
                 break;
 
         case LCP_TerminateAck:
-                serialConsole_txString("\nLCP_TerminateAck:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_TERMINATE_ACK,
+                                                   NULL, 0, options));
                 break;
 
         case LCP_CodeReject:
-                serialConsole_txString("\nLCP_CodeReject:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_CODE_REJECT,
+                                                   NULL, 0, options));
                 break;
 
         case LCP_ProtocolReject:
-                serialConsole_txString("\nLCP_ProtocolReject:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_PROTOCOL_REJECT,
+                                                   NULL, 0, options));
                 break;
 
         case LCP_EchoRequest:
-                serialConsole_txString("\nLCP_EchoRequest:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_ECHO_REQUEST,
+                                                   NULL, 0, options));
+                
+                handleEchoRequest(identifier, options);
                 break;
 
         case LCP_EchoReply:
-                serialConsole_txString("\nLCP_EchoReply:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_ECHO_REPLY,
+                                                   NULL, 0, options));
+                
+                if (identifier == echoIdentifier)
+                        statistics.echoRepliesReceived++;
                 break;
 
         case LCP_DiscardRequest:
-                serialConsole_txString("\nLCP_DiscardRequest:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_DISCARD_REQUEST,
+                                                   NULL, 0, options));
                 break;
 
         default:
-                serialConsole_txString("\nLCP_unknown:");
-                serialConsole_txDatabuffer(&txDataBuffer);
+                EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_LCP_UNKNOWN,
+                                                   NULL, 0, options));
                 break;
         }
 
-        serialConsole_txString("\n");
+        databuffer_free(options);
 }
 
-static void sendMessage(enum net_LCP_code_e code,
+static bool sendMessage(enum net_LCP_code_e code,
                            uint8_t identifier,
                            struct databuffer_basic_t *data)
 {
-        uint16_t length = data->tot_length + NET_LCP_HEADER_LENGTH;
+        uint16_t length = databuffer_getTotalLength(data) + NET_LCP_HEADER_LENGTH;
+        struct databuffer_basic_t *message;
+        uint8_t *header;
         
-        databuffer_create(&txDataBufferHeader,
-                          txDataHeader,
-                          NET_LCP_HEADER_LENGTH);
-        txDataBufferHeader.data[0] = code;
-        txDataBufferHeader.data[1] = identifier;
-        txDataBufferHeader.data[2] = (length >> 8) & 0x00FF;
-        txDataBufferHeader.data[3] = (length >> 0) & 0x00FF;
-
-        databuffer_insertAtEnd(&txDataBufferHeader, data);
-
-        net_LCP_datalink_txDataBuffer(NETPPP_LCP, &txDataBufferHeader);
+        // prepend the header in place
+        header = databuffer_push(data, NET_LCP_HEADER_LENGTH);
+        if (header == NULL)
+                return false;
+        header[0] = code;
+        header[1] = identifier;
+        header[2] = (length >> 8) & 0x00FF;
+        header[3] = (length >> 0) & 0x00FF;
+
+        // the data-link-layer releases its reference after the transmission
+        message = databuffer_clone(data);
+        if ((message == NULL) ||
+            !net_LCP_datalink_txDataBuffer(NETPPP_LCP, message))
+                return false;
+        
+        statistics.txMessages++;
+        return true;
 }
 
 static void handleConfigureRequest(uint8_t identifier,
@@ -367,36 +478,45 @@ static bool checkConfigureRequest(enum net_LCP_code_e mode,
                                   uint8_t identifier,
                                   struct databuffer_basic_t *rxOptions)
 {
+        struct databuffer_cursor_t cursor;
+        uint8_t optionType;
+        uint8_t optionLength;
         uint16_t tempShort;
         uint16_t optionReadPosition = 0;
         uint16_t optionWritePosition = 0;
-        struct net_LCP_Option_t *option = rxOptions->data;
+        uint16_t optionsLength = databuffer_getTotalLength(rxOptions);
         
-        while (optionReadPosition < rxOptions->length) {
-                option = (struct net_LCP_Option_t *)(rxOptions->data +
-                                                     optionReadPosition);
-                switch (option->type) {
+        while (optionReadPosition < optionsLength) {
+                databuffer_cursor_init(&cursor, rxOptions, optionReadPosition);
+                if (!databuffer_cursor_readU8(&cursor, &optionType) ||
+                    !databuffer_cursor_readU8(&cursor, &optionLength) ||
+                    (optionLength < 2) ||
+                    (optionLength - 2 > databuffer_cursor_getRemaining(&cursor)))
+                        break;
+                
+                switch (optionType) {
                 case LCP_OPTION_MRU:
-                        tempShort = (((uint16_t)option->data[0] << 8) |
-                                     ((uint16_t)option->data[1] << 0));
+                        if (!databuffer_cursor_readU16(&cursor, &tempShort))
+                                break;
                         if (mode == LCP_ConfigureAck) {
                                 // set the new value
                                 net_LCP_datalink_setMtuSize(tempShort);
                         } else if ((mode == LCP_ConfigureNak) &&
                                    (tempShort > net_LCP_datalink_maxMTU())) {
                                 // set possible value
-                                option->data[0] =
-                                        (net_LCP_datalink_maxMTU() >> 8)
-                                        & 0x00FF;
-                                option->data[1] =
-                                        (net_LCP_datalink_maxMTU() >> 0)
-                                        & 0x00FF;
+                                databuffer_cursor_init(&cursor,
+                                                       rxOptions,
+                                                       optionReadPosition + 2);
+                                databuffer_cursor_writeU16(&cursor,
+                                                           net_LCP_datalink_maxMTU());
                                         
                                 // copy option to the front of the buffer
-                                memcpy(&rxOptions->data[optionWritePosition],
-                                       &rxOptions->data[optionReadPosition],
-                                       option->length);
-                                optionWritePosition += option->length;
+                                databuffer_copy_partial(rxOptions,
+                                                        optionWritePosition,
+                                                        rxOptions,
+                                                        optionReadPosition,
+                                                        optionLength);
+                                optionWritePosition += optionLength;
                         }
                         break;
                         
@@ -409,12 +529,9 @@ static bool checkConfigureRequest(enum net_LCP_code_e mode,
                         break;
                         
                 case LCP_OPTION_MagicNumber:
-                        if (mode == LCP_ConfigureAck) {
-                                peerMagicNumber = (((uint32_t)option->data[0] << 24) |
-                                                   ((uint32_t)option->data[1] << 16) |
-                                                   ((uint32_t)option->data[2] <<  8) |
-                                                   ((uint32_t)option->data[3] <<  0));
-                        }
+                        if (mode == LCP_ConfigureAck)
+                                databuffer_cursor_readU32(&cursor,
+                                                          &peerMagicNumber);
                         break;
                         
                 case LCP_OPTION_AddressAndControlCompression:
@@ -433,15 +550,17 @@ static bool checkConfigureRequest(enum net_LCP_code_e mode,
                 default:
                         if (mode == LCP_ConfigureReject) {
                                 // copy option to the front of the buffer
-                                memcpy(&rxOptions->data[optionWritePosition],
-                                       &rxOptions->data[optionReadPosition],
-                                       option->length);
-                                optionWritePosition += option->length;
+                                databuffer_copy_partial(rxOptions,
+                                                        optionWritePosition,
+                                                        rxOptions,
+                                                        optionReadPosition,
+                                                        optionLength);
+                                optionWritePosition += optionLength;
                         }
                         break;
                 }
                 
-                optionReadPosition += option->length;
+                optionReadPosition += optionLength;
         }
         
         // Send answer if:
@@ -452,8 +571,7 @@ static bool checkConfigureRequest(enum net_LCP_code_e mode,
         //  (3) Mode is LCP_ConfigureAck.
         if (mode != LCP_ConfigureAck) {
                 if (optionWritePosition != 0) {
-                        rxOptions->length = optionWritePosition;
-                        rxOptions->tot_length = optionWritePosition;
+                        databuffer_trim(rxOptions, optionWritePosition);
                         
                         sendMessage(mode, identifier, rxOptions);
                 }
@@ -465,5 +583,24 @@ static bool checkConfigureRequest(enum net_LCP_code_e mode,
         return optionWritePosition == 0;
 }
 
+static void handleEchoRequest(uint8_t identifier,
+                              struct databuffer_basic_t *rxData)
+{
+        struct databuffer_cursor_t cursor;
+        
+        statistics.echoRequestsReceived++;
+        
+        // requests are only answered while the link is opened (RFC 1661)
+        if ((state & NET_LCP_STATE__OPENED) != NET_LCP_STATE__OPENED)
+                return;
+        
+        // the reply carries the data of the request with the own magic-number
+        databuffer_cursor_init(&cursor, rxData, 0);
+        if (!databuffer_cursor_writeU32(&cursor, net_LCP_getMagicNumber()))
+                return;
+        
+        sendMessage(LCP_EchoReply, identifier, rxData);
+}
+
 
 // interrupt service routines
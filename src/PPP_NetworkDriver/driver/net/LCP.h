@@ -1,11 +1,17 @@
 /**
  *******************************************************************************
  * @file        LCP.h
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Header file of the LCP-Protocol-Stack.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added net_LCP_setMru, net_LCP_getMru and
+ *                         net_LCP_sendEchoRequest. (MS)
+ *                      -# Added net_LCP_getStatistics and
+ *                         net_LCP_resetStatistics. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Added net_LCP_getState. (MS)
  *                      -# Added net_LCP_startConfigurationOfHost. (MS)
@@ -58,6 +64,36 @@ extern "C" {
 #define NET_LCP_STATE__HOST_CONFIGURED          BV(0)
 #define NET_LCP_STATE__CLIENT_CONFIGURED        BV(1)
 
+/**
+ *  This structure holds a snapshot of the counters of the LCP-Module.
+ */
+struct net_LCP_statistics_t {
+        /**
+         * Number of received LCP-Messages.
+         */
+        uint16_t                        rxMessages;
+
+        /**
+         * Number of transmitted LCP-Messages.
+         */
+        uint16_t                        txMessages;
+
+        /**
+         * Number of transmitted Echo-Requests (see net_LCP_sendEchoRequest).
+         */
+        uint16_t                        echoRequestsSent;
+
+        /**
+         * Number of received Echo-Replies that answered an own Echo-Request.
+         */
+        uint16_t                        echoRepliesReceived;
+
+        /**
+         * Number of received Echo-Requests of the peer.
+         */
+        uint16_t                        echoRequestsReceived;
+};
+
 /**
  *  Initializes the LCP-Protocol-Stack on the Data-Link-Layer.
  *  @return     None.
@@ -82,6 +118,52 @@ uint8_t net_LCP_getState(void);
  */
 void net_LCP_startConfigurationOfHost(void);
 
+/**
+ *  Sets the MRU that is requested by the next Configure-Request.
+ *  @param      mru: New MRU in Bytes.
+ *  @return     true if the MRU is valid, false if it is less than
+ *              NET_LCP_MRU_MIN or greater than the MTU of the Data-Link-Layer.
+ *  @pre        net_LCP_init has been called.
+ *  @post       The MRU is changed if it is valid.
+ */
+bool net_LCP_setMru(uint16_t mru);
+
+/**
+ *  Returns the MRU that is requested by the Configure-Request.
+ *  @return     MRU in Bytes.
+ *  @pre        net_LCP_init has been called.
+ *  @post       None.
+ */
+uint16_t net_LCP_getMru(void);
+
+/**
+ *  Sends an Echo-Request to test the link. The answer of the peer is counted
+ *  by echoRepliesReceived of the statistics.
+ *  @return     true if the Echo-Request had been sent, false if the link is not
+ *              opened, the DataBuffer-Pools are exhausted or the
+ *              Data-Link-Layer is busy.
+ *  @pre        net_LCP_init has been called.
+ *  @post       None.
+ */
+bool net_LCP_sendEchoRequest(void);
+
+/**
+ *  Copies the counters of the LCP-Module.
+ *  @param      statistics: Buffer that will hold the counters.
+ *  @return     None.
+ *  @pre        net_LCP_init has been called.
+ *  @post       None.
+ */
+void net_LCP_getStatistics(struct net_LCP_statistics_t *statistics);
+
+/**
+ *  Sets the counters of the LCP-Module to 0.
+ *  @return     None.
+ *  @pre        net_LCP_init has been called.
+ *  @post       None.
+ */
+void net_LCP_resetStatistics(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
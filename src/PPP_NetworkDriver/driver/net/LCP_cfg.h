@@ -1,11 +1,15 @@
 /**
  *******************************************************************************
  * @file        LCP_cfg.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Config file of the LCP-Protocol-Stack.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added NET_LCP_LOG_LEVEL. (MS)
+ *                      -# Added NET_LCP_MRU_MIN. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -56,4 +60,22 @@
  */
 #define NET_LCP_DATALINK               PPP
 
+/**
+ *  Log-level of the module (see eventLog.h). The events of the higher levels
+ *  are removed by the compiler.                                              @n
+ *  Possible values are:                                                      @n
+ *  EVENTLOG_LEVEL_NONE                                                       @n
+ *  EVENTLOG_LEVEL_ERROR                                                      @n
+ *  EVENTLOG_LEVEL_WARNING                                                    @n
+ *  EVENTLOG_LEVEL_INFO                                                       @n
+ *  EVENTLOG_LEVEL_DEBUG
+ */
+#define NET_LCP_LOG_LEVEL              EVENTLOG_LEVEL_DEBUG
+
+/**
+ *  Minimum MRU that can be set by net_LCP_setMru. IPV4 needs at least 68
+ *  Bytes (RFC 791).
+ */
+#define NET_LCP_MRU_MIN                (68)
+
 #endif /* _NET_LCP_CFG_H_ */
@@ -1,8 +1,8 @@
 /**
  *******************************************************************************
  * @file        PPP.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Source file of the PPP-Protocol-Stack.
  *              This module implements the PPP-Protocol-Stack for the
@@ -11,6 +11,36 @@
  *              be transfered to a higher level by executing a
  *              callback-function. The frame-format of the PPP-packets is HDLC.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# The transmitted DataBuffer-Chain is released after
+ *                         the transmission. (MS)
+ *                      -# Optional coalescing of TX-frames
+ *                         (NET_PPP_TX_COALESCE). (MS)
+ *                      -# TX-data may be located in the program-memory.
+ *                         (MS)
+ *                      -# Received frames are allocated from the DataBuffer-
+ *                         Pools and passed to net_PPP_loop by a
+ *                         databuffer_queue_t. (MS)
+ *                      -# RTS/CTS flow-control by the RX-Queue. (MS)
+ *                      -# The RX-/TX-Callbacks are public as net_PPP_rxHandler
+ *                         and net_PPP_txHandler for the direct call by the
+ *                         interrupt service routines. (MS)
+ *                      -# Optional automatic baudrate detection
+ *                         (NET_PPP_AUTOBAUD). (MS)
+ *                      -# Added net_PPP_getBaudrate. (MS)
+ *                      -# The debug-output is recorded by the event-log.
+ *                         (MS)
+ *                      -# The events are filtered by NET_PPP_LOG_LEVEL.
+ *                         (MS)
+ *                      -# Added net_PPP_getStatistics and
+ *                         net_PPP_resetStatistics. (MS)
+ *                      -# The frames are passed to the frame-capture
+ *                         (NET_PPP_CAPTURE). (MS)
+ *                      -# The received frames and the end of a
+ *                         transmission are posted to the scheduler. (MS)
+ *                      -# Added net_PPP_getUartIsrCycles. (MS)
+ *                      -# Added net_PPP_getUartTxByteCount. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Added net_PPP_setMtuSize. (MS)
  *                      -# Corrected Indentiation. (MS)
@@ -59,12 +89,39 @@
 #include "..\\..\\system.h"
 #include "..\\..\\utils\\crc.h"
 #include "..\\..\\utils\\databuffer.h"
+#include "..\\..\\utils\\eventLog.h"
 #include "..\\..\\utils\\serialConsole.h"
+#include "..\\..\\utils\\cycleCounter.h"
+#include "..\\..\\utils\\capture.h"
+#include "..\\..\\utils\\scheduler.h"
+
+#define EVENTLOG_MODULE_LEVEL NET_PPP_LOG_LEVEL
+#include "..\\..\\utils\\eventLog_level.h"
+
+#include <string.h>
+#include <util/atomic.h>
 
 #if NET_PPP_MTU_MAX < (576)
         #error "NET_PPP_MTU_MAX must be greater or equal to 576"
 #endif
 
+#if DATABUFFER_POOL_LARGEBLOCK_SIZE < (NET_PPP_MTU_MAX + 4)
+        #error "DATABUFFER_POOL_LARGEBLOCK_SIZE must hold a frame of NET_PPP_MTU_MAX"
+#endif
+
+#if NET_PPP_RX_PACKET_BUFFER_SIZE > DATABUFFER_QUEUE_MAX_PACKETS
+        #error "NET_PPP_RX_PACKET_BUFFER_SIZE must not exceed DATABUFFER_QUEUE_MAX_PACKETS"
+#endif
+
+#if DATABUFFER_POOL_LARGEBLOCKS < (NET_PPP_RX_PACKET_BUFFER_SIZE + 2)
+        #error "DATABUFFER_POOL_LARGEBLOCKS must be at least NET_PPP_RX_PACKET_BUFFER_SIZE + 2"
+#endif
+
+#if (NET_PPP_RX_LOWWATERMARK >= NET_PPP_RX_HIGHWATERMARK) || \
+    (NET_PPP_RX_HIGHWATERMARK > NET_PPP_RX_PACKET_BUFFER_SIZE)
+        #error "Illegal setting of NET_PPP_RX_HIGHWATERMARK or NET_PPP_RX_LOWWATERMARK"
+#endif
+
 #define NET_PPP_UARTPREFIX \
         CONCAT2(NET_PPP_UARTTYPE, NET_PPP_UARTNUMBER)
 #define NET_PPP_UARTINCLUDE \
@@ -77,6 +134,25 @@
         CONCAT2(NET_PPP_UARTPREFIX, _setTxFinishedCallback)
 #define net_PPP_uart_txByte \
         CONCAT2(NET_PPP_UARTPREFIX, _txByte)
+#define net_PPP_uart_setRts \
+        CONCAT2(NET_PPP_UARTPREFIX, _setRts)
+#define net_PPP_uart_checkCts \
+        CONCAT2(NET_PPP_UARTPREFIX, _checkCts)
+#define net_PPP_uart_initUbrr \
+        CONCAT2(NET_PPP_UARTPREFIX, _initUbrr)
+#define net_PPP_uart_getIsrCycles \
+        CONCAT2(NET_PPP_UARTPREFIX, _getIsrCycles)
+#define net_PPP_uart_getTxByteCount \
+        CONCAT2(NET_PPP_UARTPREFIX, _getTxByteCount)
+
+#ifdef NET_PPP_AUTOBAUD
+        #if (NET_PPP_AUTOBAUD_INT < 0) || (NET_PPP_AUTOBAUD_INT > 3)
+                #error "Illegal setting of NET_PPP_AUTOBAUD_INT! Should be [0, 3]."
+        #endif
+        #if (NET_PPP_AUTOBAUD_FLAGS < 1) || (NET_PPP_AUTOBAUD_FLAGS > 28)
+                #error "Illegal setting of NET_PPP_AUTOBAUD_FLAGS! Should be [1, 28]."
+        #endif
+#endif /* NET_PPP_AUTOBAUD */
 
 #include NET_PPP_UARTINCLUDE
 
@@ -122,13 +198,20 @@ union net_PPP_lastReceivedBytes_t {
 };
 
 // private function prototypes
-static void rxFinishedCallback(uint8_t b);
-static void txFinishedCallback(void);
 inline static void txByte(uint8_t b);
 static void rxCallback_DUMMY(struct databuffer_basic_t *rxDataBuffer);
+static void rxFrameReceived(uint16_t length);
+#ifdef NET_PPP_AUTOBAUD
+static void autobaudStart(void);
+static void autobaudFinish(void);
+static bool autobaudIsBitMultiple(uint16_t duration,
+                                  uint8_t numberOfBits,
+                                  uint16_t flagDuration);
+#endif /* NET_PPP_AUTOBAUD */
 
 // private data
 static enum net_PPP_state_e PPPstate;
+static struct databuffer_basic_t *txDataBufferChain;
 static struct databuffer_basic_t *txDataBuffer;
 static uint16_t txDataBufferReadIndex;
 static enum net_PPP_txState_e txState;
@@ -136,20 +219,30 @@ static enum net_PPP_protocol_e txProtocol;
 static crc16_t txFCScalc;
 static crc16_t txFCSvalue;
 static uint8_t txEscapeCharacter;
-static uint8_t rxBuffer[NET_PPP_RX_PACKET_BUFFER_SIZE][NET_PPP_MTU_MAX + 2];
-static struct databuffer_basic_t rxDataBuffer[NET_PPP_RX_PACKET_BUFFER_SIZE];
+static struct databuffer_basic_t *rxFrame;
+static struct databuffer_queue_t rxQueue;
 static uint16_t rxDataBufferWriteIndex;
-static uint8_t numberOfRxPackets;
-static uint8_t indexOfLastRxPacket;
-static uint8_t indexOfFirstEmptyPacket;
 static enum net_PPP_rxState_e rxState;
 static crc16_t rxFCScalc;
 static crc16_t rxFCSvalue;
 static crc16_t rxFCS;
 static uint8_t rxEscapeCharacter;
-static enum  net_PPP_protocol_e rxProtocol[NET_PPP_RX_PACKET_BUFFER_SIZE];
+static enum  net_PPP_protocol_e rxProtocol;
 static union net_PPP_lastReceivedBytes_t rxLastBytes;
 static uint16_t mtuSize;
+static struct net_PPP_statistics_t statistics;
+static uint32_t baudrate;
+static uint16_t baudrateError;
+#ifdef NET_PPP_AUTOBAUD
+static bool autobaudIsFinished;
+static volatile uint8_t autobaudFlags;
+static volatile uint32_t autobaudCycles;
+#endif /* NET_PPP_AUTOBAUD */
+#ifdef NET_PPP_CAPTURE
+// the RX-frame holds the protocol, the TX-frame only the information-field
+static const uint8_t rxHeader[2] = {NET_PPP_ADDRESS, NET_PPP_CONTROL};
+static uint8_t txHeader[4] = {NET_PPP_ADDRESS, NET_PPP_CONTROL, 0, 0};
+#endif /* NET_PPP_CAPTURE */
 // RX-Callback-Functions
 static void (*rxCallback_IP)(struct databuffer_basic_t *rxDataBuffer) =
         rxCallback_DUMMY;
@@ -159,61 +252,122 @@ static void (*rxCallback_LCP)(struct databuffer_basic_t *rxDataBuffer) =
 // public functions
 void net_PPP_init(void)
 {
+#ifdef NET_PPP_AUTOBAUD
+        // the UART is initialized by net_PPP_loop after the detection
+        baudrate = 0;
+        baudrateError = 0;
+        autobaudStart();
+#else
         net_PPP_uart_init(NET_PPP_BAUDRATE);
-        net_PPP_uart_setRxFinishedCallback(rxFinishedCallback);
-        net_PPP_uart_setTxFinishedCallback(txFinishedCallback);
+        baudrate = NET_PPP_BAUDRATE;
+        baudrateError = USART_BAUDRATE_ERROR_SELECTED(NET_PPP_BAUDRATE);
+#endif /* NET_PPP_AUTOBAUD */
+        net_PPP_uart_setRxFinishedCallback(net_PPP_rxHandler);
+        net_PPP_uart_setTxFinishedCallback(net_PPP_txHandler);
         
         PPPstate = PPPState_Dead;
         
         mtuSize = NET_PPP_MTU_MAX;
         
+        txDataBufferChain = NULL;
         txDataBuffer = NULL;
         txState = PPPtxState_Idle;
         
-        for (uint8_t i=0; i<NET_PPP_RX_PACKET_BUFFER_SIZE; i++)
-                databuffer_create(&(rxDataBuffer[i]),
-                                  rxBuffer[i],
-                                  NET_PPP_MTU_MAX);
+        rxFrame = NULL;
+        databuffer_queue_init(&rxQueue,
+                              NET_PPP_RX_PACKET_BUFFER_SIZE,
+                              NET_PPP_RX_PACKET_BUFFER_SIZE * (NET_PPP_MTU_MAX + 2),
+                              NET_PPP_RX_QUEUE_POLICY);
         
         rxState = PPPrxState_WaitingForSync;
         rxLastBytes.raw = 0;
         
-        numberOfRxPackets = 0;
-        indexOfLastRxPacket = 0;
-        indexOfFirstEmptyPacket = 0;
+        memset(&statistics, 0, sizeof(statistics));
 }
 
 void net_PPP_loop(void)
 {
-        while (numberOfRxPackets > 0) {
-                switch (rxProtocol[indexOfLastRxPacket]) {
+        struct databuffer_basic_t *frame;
+        struct databuffer_cursor_t cursor;
+        uint16_t protocol;
+        
+#ifdef NET_PPP_AUTOBAUD
+        if (!autobaudIsFinished) {
+                if (autobaudFlags < NET_PPP_AUTOBAUD_FLAGS)
+                        return;
+                autobaudFinish();
+        }
+#endif /* NET_PPP_AUTOBAUD */
+        
+        // continue a transmission that has been paused by the remote side
+        net_PPP_uart_checkCts();
+        
+        while ((frame = databuffer_queue_dequeue(&rxQueue)) != NULL) {
+#ifdef NET_PPP_CAPTURE
+                // the timestamp is taken here and not at the reception
+                capture_write(0, rxHeader, sizeof(rxHeader), frame);
+#endif /* NET_PPP_CAPTURE */
+                
+                // the protocol is stored in front of the information-field
+                databuffer_cursor_init(&cursor, frame, 0);
+                databuffer_cursor_readU16(&cursor, &protocol);
+                databuffer_pull(frame, 2);
+                
+                switch ((enum net_PPP_protocol_e)protocol) {
                 case NETPPP_IP:
-                        rxCallback_IP(&(rxDataBuffer[indexOfLastRxPacket]));
+                        rxCallback_IP(frame);
                         break;
                 case NETPPP_LCP:
                         if (PPPstate == PPPState_Dead) {
                                 PPPstate = PPPState_Establish;
-                                serialConsole_txString("PPPState_Establish\n");
+                                EVENTLOG_INFO(eventLog_writeEvent(EVENTLOG_PPP_ESTABLISH));
                         }
-                        rxCallback_LCP(&(rxDataBuffer[indexOfLastRxPacket]));
+                        rxCallback_LCP(frame);
                         break;
                 default:
-                        serialConsole_txByte((rxProtocol[indexOfLastRxPacket] >> 8) & 0x00FF);
-                        serialConsole_txByte((rxProtocol[indexOfLastRxPacket] >> 0) & 0x00FF);
-                        rxCallback_DUMMY(&(rxDataBuffer[indexOfLastRxPacket]));
+                        EVENTLOG_WARNING(eventLog_write(EVENTLOG_PPP_RX_PROTOCOL_UNKNOWN,
+                                                        &protocol,
+                                                        sizeof(protocol)));
+                        rxCallback_DUMMY(frame);
                         break;
                 }
                 
-                indexOfLastRxPacket = (indexOfLastRxPacket + 1)
-                                      % NET_PPP_RX_PACKET_BUFFER_SIZE;
-                numberOfRxPackets--;
+                databuffer_free(frame);
         }
+        
+        // the frames had been processed, the remote side may continue
+        if (databuffer_queue_getPacketCount(&rxQueue) <= NET_PPP_RX_LOWWATERMARK)
+                net_PPP_uart_setRts(true);
 }
 
-void net_PPP_txDataBuffer(enum net_PPP_protocol_e protocol,
+bool net_PPP_txDataBuffer(enum net_PPP_protocol_e protocol,
                           struct databuffer_basic_t *dataBufferChain)
 {
-        if ((txDataBuffer == NULL) && (dataBufferChain->tot_length > 0)) {
+#ifdef NET_PPP_AUTOBAUD
+        if (!autobaudIsFinished) {
+                // the UART has not been initialized
+                databuffer_free(dataBufferChain);
+                return false;
+        }
+#endif /* NET_PPP_AUTOBAUD */
+        
+        if ((txDataBufferChain == NULL) && (databuffer_getTotalLength(dataBufferChain) > 0)) {
+#ifdef NET_PPP_TX_COALESCE
+                // less segments mean less pointer-hopping in the TX-path, the
+                // chain stays valid if the pools are empty
+                databuffer_coalesce(dataBufferChain);
+#endif /* NET_PPP_TX_COALESCE */
+                
+#ifdef NET_PPP_CAPTURE
+                txHeader[2] = (uint8_t)(protocol >> 8);
+                txHeader[3] = (uint8_t)protocol;
+                capture_write(CAPTURE_FLAG_TX,
+                              txHeader,
+                              sizeof(txHeader),
+                              dataBufferChain);
+#endif /* NET_PPP_CAPTURE */
+                
+                txDataBufferChain = dataBufferChain;
                 txDataBuffer = dataBufferChain;
                 txDataBufferReadIndex = 0;
                 txProtocol = protocol;
@@ -222,12 +376,18 @@ void net_PPP_txDataBuffer(enum net_PPP_protocol_e protocol,
                 // Transmit SOF-Flag.
                 net_PPP_uart_txByte(NET_PPP_FLAG);
                 txState = PPPtxState_SOF_Flag;
+                return true;
         }
+        
+        // drop the frame
+        databuffer_free(dataBufferChain);
+        statistics.txDrops++;
+        return false;
 }
 
 bool net_PPP_txIsBusy(void)
 {
-        return txDataBuffer != NULL;
+        return txDataBufferChain != NULL;
 }
 
 void net_PPP_setLCPRxCallback(void (*rxCallback)(struct databuffer_basic_t *rxDataBuffer))
@@ -262,9 +422,43 @@ enum net_PPP_state_e net_PPP_getState(void)
         return PPPstate;
 }
 
+uint32_t net_PPP_getBaudrate(uint16_t *error)
+{
+        if (error != NULL)
+                *error = baudrateError;
+        
+        return baudrate;
+}
 
-// private functions
-static void rxFinishedCallback(uint8_t b)
+void net_PPP_getUartIsrCycles(uint16_t *rxCyclesMax, uint16_t *txCyclesMax)
+{
+        net_PPP_uart_getIsrCycles(rxCyclesMax, txCyclesMax);
+}
+
+uint32_t net_PPP_getUartTxByteCount(void)
+{
+        return net_PPP_uart_getTxByteCount();
+}
+
+void net_PPP_getStatistics(struct net_PPP_statistics_t *statisticsCopy)
+{
+        // the RX-counters are changed by the interrupt service routine
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                *statisticsCopy = statistics;
+                statisticsCopy->rxQueueDrops =
+                        databuffer_queue_getDropCount(&rxQueue);
+        }
+}
+
+void net_PPP_resetStatistics(void)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                memset(&statistics, 0, sizeof(statistics));
+                rxQueue.drops = 0;
+        }
+}
+
+void net_PPP_rxHandler(uint8_t b)
 {
         bool hasFlag = false;
         
@@ -322,7 +516,7 @@ static void rxFinishedCallback(uint8_t b)
                                 rxState = PPPrxState_SOF_Flag;
                         } else {
                                 // Received first Protocol-Byte.
-                                rxProtocol[indexOfFirstEmptyPacket] =
+                                rxProtocol =
                                         ((enum net_PPP_protocol_e)b) << 8;
                                 rxState = PPPrxState_ProtocolH;
                         }
@@ -334,7 +528,7 @@ static void rxFinishedCallback(uint8_t b)
                                 rxState = PPPrxState_SOF_Flag;
                         } else {
                                 // Received second Protocol-Byte.
-                                rxProtocol[indexOfFirstEmptyPacket] |=
+                                rxProtocol |=
                                         (enum net_PPP_protocol_e)b;
                                 rxState = PPPrxState_ProtocolL;
                         }
@@ -346,10 +540,20 @@ static void rxFinishedCallback(uint8_t b)
                                 rxState = PPPrxState_SOF_Flag;
                         } else {
                                 // Received first Data-Byte.
-                                rxDataBufferWriteIndex = 0;
-                                rxDataBuffer[indexOfFirstEmptyPacket].data[rxDataBufferWriteIndex++] =
-                                        b;
-                                rxState = PPPrxState_Data;
+                                if (rxFrame == NULL)
+                                        rxFrame = databuffer_allocWithHeadroom(2, NET_PPP_MTU_MAX + 2);
+                                
+                                if (rxFrame != NULL) {
+                                        rxDataBufferWriteIndex = 0;
+                                        rxFrame->data[rxDataBufferWriteIndex++] =
+                                                b;
+                                        rxState = PPPrxState_Data;
+                                } else {
+                                        // No memory, drop the frame.
+                                        net_PPP_uart_setRts(false);
+                                        statistics.rxNoMemory++;
+                                        rxState = PPPrxState_WaitingForSync;
+                                }
                         }
                         break;
                 
@@ -364,44 +568,35 @@ static void rxFinishedCallback(uint8_t b)
                                 crc16_fcs_byte(&rxFCScalc,
                                                NET_PPP_CONTROL);
                                 crc16_fcs_byte(&rxFCScalc,
-                                               (rxProtocol[indexOfFirstEmptyPacket] >> 8) & 0x00FF);
+                                               (rxProtocol >> 8) & 0x00FF);
                                 crc16_fcs_byte(&rxFCScalc,
-                                               (rxProtocol[indexOfFirstEmptyPacket] >> 0) & 0x00FF);
+                                               (rxProtocol >> 0) & 0x00FF);
                                 crc16_fcs_data(&rxFCScalc,
-                                               rxDataBuffer[indexOfFirstEmptyPacket].data,
+                                               rxFrame->data,
                                                rxDataBufferWriteIndex - 2);
                                 rxFCSvalue = rxFCScalc ^ 0xFFFF;
-                                rxFCS = ((crc16_t)rxDataBuffer[indexOfFirstEmptyPacket].data[rxDataBufferWriteIndex - 1] << 8) |
-                                        (crc16_t)rxDataBuffer[indexOfFirstEmptyPacket].data[rxDataBufferWriteIndex - 2];
+                                rxFCS = ((crc16_t)rxFrame->data[rxDataBufferWriteIndex - 1] << 8) |
+                                        (crc16_t)rxFrame->data[rxDataBufferWriteIndex - 2];
                                 //rxFCS = rxFCSvalue;
                                 
                                 if (rxFCS == rxFCSvalue) {
                                         // Received valid ppp-packet.
-                                        rxDataBuffer[indexOfFirstEmptyPacket].length =
-                                                rxDataBufferWriteIndex - 2;
-                                        rxDataBuffer[indexOfFirstEmptyPacket].tot_length =
-                                                rxDataBufferWriteIndex - 2;
-                                        
-                                        indexOfFirstEmptyPacket =
-                                                (indexOfFirstEmptyPacket + 1)
-                                                % NET_PPP_RX_PACKET_BUFFER_SIZE;
-                                        numberOfRxPackets++;
+                                        rxFrameReceived(rxDataBufferWriteIndex - 2);
                                 } else {
                                         // No valid ppp-packet received.
-                                        serialConsole_txString("\n\n");
-                                        serialConsole_txByte((rxProtocol[indexOfFirstEmptyPacket] >> 8) & 0x00FF);
-                                        serialConsole_txByte((rxProtocol[indexOfFirstEmptyPacket] >> 0) & 0x00FF);
-                                        serialConsole_txByte((rxFCS >> 8) & 0x00FF);
-                                        serialConsole_txByte((rxFCS >> 0) & 0x00FF);
-                                        serialConsole_txByte((rxFCSvalue >> 8) & 0x00FF);
-                                        serialConsole_txByte((rxFCSvalue >> 0) & 0x00FF);
-                                        serialConsole_txString("\n\n");
+                                        statistics.rxFcsErrors++;
+                                        EVENTLOG_WARNING(eventLog_write(
+                                                EVENTLOG_PPP_RX_FCS_INVALID,
+                                                ((uint16_t[3]){rxProtocol,
+                                                               rxFCS,
+                                                               rxFCSvalue}),
+                                                3 * sizeof(uint16_t)));
                                 }
                                 
                                 rxState = PPPrxState_SOF_Flag;
                         } else if (rxDataBufferWriteIndex < mtuSize) {
                                 // Received n-th Data-Byte.
-                                rxDataBuffer[indexOfFirstEmptyPacket].data[rxDataBufferWriteIndex++] = b;
+                                rxFrame->data[rxDataBufferWriteIndex++] = b;
                         } else {
                                 // Reached mtu-limit.
                                 
@@ -412,11 +607,11 @@ static void rxFinishedCallback(uint8_t b)
                                 crc16_fcs_byte(&rxFCScalc,
                                                NET_PPP_CONTROL);
                                 crc16_fcs_byte(&rxFCScalc,
-                                               (rxProtocol[indexOfFirstEmptyPacket] >> 8) & 0x00FF);
+                                               (rxProtocol >> 8) & 0x00FF);
                                 crc16_fcs_byte(&rxFCScalc,
-                                               (rxProtocol[indexOfFirstEmptyPacket] >> 0) & 0x00FF);
+                                               (rxProtocol >> 0) & 0x00FF);
                                 crc16_fcs_data(&rxFCScalc,
-                                               rxDataBuffer[indexOfFirstEmptyPacket].data,
+                                               rxFrame->data,
                                                rxDataBufferWriteIndex);
                                 rxFCSvalue = rxFCScalc ^ 0xFFFF;
                                 
@@ -447,15 +642,7 @@ static void rxFinishedCallback(uint8_t b)
                                 // Received valid Flag.
                                 rxState = PPPrxState_SOF_Flag;
                                 
-                                rxDataBuffer[indexOfFirstEmptyPacket].length =
-                                        rxDataBufferWriteIndex;
-                                rxDataBuffer[indexOfFirstEmptyPacket].tot_length =
-                                        rxDataBufferWriteIndex;
-                                
-                                indexOfFirstEmptyPacket =
-                                        (indexOfFirstEmptyPacket + 1)
-                                        % NET_PPP_RX_PACKET_BUFFER_SIZE;
-                                numberOfRxPackets++;
+                                rxFrameReceived(rxDataBufferWriteIndex);
                         } else {
                                 // Out of sync...
                                 rxState = PPPrxState_WaitingForSync;
@@ -468,7 +655,7 @@ static void rxFinishedCallback(uint8_t b)
         }
 }
 
-static void txFinishedCallback(void)
+void net_PPP_txHandler(void)
 {
         if (txEscapeCharacter == 0xFF) {
                 switch (txState) {
@@ -505,7 +692,8 @@ static void txFinishedCallback(void)
                 
                 case PPPtxState_ProtocolL:
                         // Transmit first Data-Byte.
-                        txByte(txDataBuffer->data[txDataBufferReadIndex++]);
+                        txByte(databuffer_readByte(txDataBuffer,
+                                                   txDataBufferReadIndex++));
                         
                         if (txDataBufferReadIndex >= txDataBuffer->length) {
                                 txDataBuffer = txDataBuffer->next;
@@ -519,7 +707,8 @@ static void txFinishedCallback(void)
                 case PPPtxState_Data:
                         if (txDataBuffer != NULL) {
                                 // Transmit n-th Data-Byte.
-                                txByte(txDataBuffer->data[txDataBufferReadIndex++]);
+                                txByte(databuffer_readByte(txDataBuffer,
+                                                           txDataBufferReadIndex++));
                                 
                                 if (txDataBufferReadIndex >= txDataBuffer->length) {
                                         txDataBuffer = txDataBuffer->next;
@@ -551,9 +740,14 @@ static void txFinishedCallback(void)
                 
                 case PPPtxState_EOF_Flag:
                         // End of Transmission.
+                        statistics.txFrames++;
+                        /* fall through */
                 default:
+                        databuffer_free(txDataBufferChain);
+                        txDataBufferChain = NULL;
                         txDataBuffer = NULL;
                         txState = PPPtxState_Idle;
+                        scheduler_post(SCHEDULER_EVENT_PPP_TX);
                         
                         break;
                 }
@@ -563,6 +757,8 @@ static void txFinishedCallback(void)
         }
 }
 
+
+// private functions
 inline static void txByte(uint8_t b)
 {
         crc16_fcs_byte(&txFCScalc, b);
@@ -577,10 +773,125 @@ inline static void txByte(uint8_t b)
 
 static void rxCallback_DUMMY(struct databuffer_basic_t *rxDataBuffer)
 {
-        serialConsole_txString("\nrecv_?:");
-        serialConsole_txDatabuffer(rxDataBuffer);
-        serialConsole_txString("\n");
+        EVENTLOG_DEBUG(eventLog_writeChain(EVENTLOG_PPP_RX_UNKNOWN,
+                                           NULL,
+                                           0,
+                                           rxDataBuffer));
+}
+
+static void rxFrameReceived(uint16_t length)
+{
+        uint8_t *protocol;
+        
+        // the data had been written directly into the tailroom
+        databuffer_put(rxFrame, length);
+        statistics.rxFrames++;
+        
+        protocol = databuffer_push(rxFrame, 2);
+        protocol[0] = ((uint16_t)rxProtocol >> 8) & 0x00FF;
+        protocol[1] = ((uint16_t)rxProtocol >> 0) & 0x00FF;
+        
+        // the queue drops the frame if it is full
+        databuffer_queue_enqueue(&rxQueue, rxFrame);
+        rxFrame = NULL;
+        scheduler_post(SCHEDULER_EVENT_PPP_RX);
+        
+        // stop the remote side before the queue overflows
+        if (databuffer_queue_getPacketCount(&rxQueue) >= NET_PPP_RX_HIGHWATERMARK)
+                net_PPP_uart_setRts(false);
 }
 
+#ifdef NET_PPP_AUTOBAUD
+static void autobaudStart(void)
+{
+        autobaudIsFinished = false;
+        autobaudFlags = 0;
+        autobaudCycles = 0;
+        
+        cycleCounter_init();
+        
+        // the RX-Pin is an input, every edge triggers the interrupt
+        DDRD &= ~BV(NET_PPP_AUTOBAUD_INT);
+        EICRA = (EICRA & ~BV(CONCAT3(ISC, NET_PPP_AUTOBAUD_INT, 1))) |
+                BV(CONCAT3(ISC, NET_PPP_AUTOBAUD_INT, 0));
+        EIFR = BV(CONCAT2(INTF, NET_PPP_AUTOBAUD_INT));
+        EIMSK |= BV(CONCAT2(INT, NET_PPP_AUTOBAUD_INT));
+}
 
-// interrupt service routines
+static void autobaudFinish(void)
+{
+        // the interrupt service routine has disabled the interrupt
+        net_PPP_uart_initUbrr(usart_calculateUbrr(autobaudCycles,
+                                                  NET_PPP_AUTOBAUD_FLAGS * 9,
+                                                  &baudrateError));
+        baudrate = (F_CPU * NET_PPP_AUTOBAUD_FLAGS * 9) / autobaudCycles;
+        autobaudIsFinished = true;
+        
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_INFO
+        {
+                uint8_t eventArgs[6];
+
+                memcpy(&eventArgs[0], &baudrate, 4);
+                memcpy(&eventArgs[4], &baudrateError, 2);
+                eventLog_write(EVENTLOG_PPP_BAUDRATE,
+                               eventArgs,
+                               sizeof(eventArgs));
+        }
+#endif
+}
+
+static bool autobaudIsBitMultiple(uint16_t duration,
+                                  uint8_t numberOfBits,
+                                  uint16_t flagDuration)
+{
+        // a Flag has 9 Bits from the first to the last edge, a tolerance
+        // of a quarter Bit is allowed
+        int32_t difference = (int32_t)duration * 9 -
+                             (int32_t)flagDuration * numberOfBits;
+        
+        return labs(difference) <= (int32_t)(flagDuration / 4);
+}
+#endif /* NET_PPP_AUTOBAUD */
+
+
+// interrupt service routines
+#ifdef NET_PPP_AUTOBAUD
+ISR(CONCAT3(INT, NET_PPP_AUTOBAUD_INT, _vect))
+{
+        // timestamps and levels of the last 4 edges, the newest is in the
+        // least significant Bit
+        static uint16_t edges[4];
+        static uint8_t levels;
+        uint16_t flagDuration;
+        uint32_t cycles;
+        
+        edges[0] = edges[1];
+        edges[1] = edges[2];
+        edges[2] = edges[3];
+        edges[3] = cycleCounter_read();
+        levels = (levels << 1) | ((PIND & BV(NET_PPP_AUTOBAUD_INT)) ? 1 : 0);
+        
+        // A Flag (0x7E) is LOW for 2 Bits (Start-Bit and Bit 0), HIGH for
+        // 6 Bits (Bit 1 to 6) and LOW for 1 Bit (Bit 7) before the Stop-Bit.
+        if ((levels & 0x0F) != 0x05)
+                return;
+        flagDuration = edges[3] - edges[0];
+        if (!autobaudIsBitMultiple(edges[1] - edges[0], 2, flagDuration) ||
+            !autobaudIsBitMultiple(edges[2] - edges[1], 6, flagDuration) ||
+            !autobaudIsBitMultiple(edges[3] - edges[2], 1, flagDuration))
+                return;
+        
+        // start again if the Flag does not match the previous ones (3 %)
+        cycles = (uint32_t)flagDuration * autobaudFlags;
+        if (labs((int32_t)(cycles - autobaudCycles)) >
+            (int32_t)(autobaudCycles / 32)) {
+                autobaudFlags = 0;
+                autobaudCycles = 0;
+        }
+        
+        autobaudCycles += flagDuration;
+        autobaudFlags++;
+        if (autobaudFlags >= NET_PPP_AUTOBAUD_FLAGS)
+                EIMSK &= ~BV(CONCAT2(INT, NET_PPP_AUTOBAUD_INT));
+}
+#endif /* NET_PPP_AUTOBAUD */
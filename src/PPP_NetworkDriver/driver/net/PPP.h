@@ -1,8 +1,8 @@
 /**
  *******************************************************************************
  * @file        PPP.h
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Header file of the PPP-Protocol-Stack.
  *              This module implements the PPP-Protocol-Stack for the
@@ -11,6 +11,19 @@
  *              be transfered to a higher level by executing a
  *              callback-function. The frame-format of the PPP-packets is HDLC.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# net_PPP_txDataBuffer takes the ownership of the
+ *                         DataBuffer-Chain and returns if it is transmitted.
+ *                         (MS)
+ *                      -# Added net_PPP_rxHandler and net_PPP_txHandler. (MS)
+ *                      -# Added net_PPP_getBaudrate. (MS)
+ *                      -# Added net_PPP_getStatistics and
+ *                         net_PPP_resetStatistics. (MS)
+ *                      -# The events of net_PPP_loop are posted to the
+ *                         scheduler. (MS)
+ *                      -# Added net_PPP_getUartIsrCycles. (MS)
+ *                      -# Added net_PPP_getUartTxByteCount. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Added net_PPP_setMtuSize. (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -80,6 +93,43 @@ enum net_PPP_state_e {
         PPPState_Terminate,
 };
 
+/**
+ *  This structure holds a snapshot of the counters of the PPP-Module.
+ */
+struct net_PPP_statistics_t {
+        /**
+         * Number of received frames with a valid FCS.
+         */
+        uint16_t                        rxFrames;
+
+        /**
+         * Number of received frames with an invalid FCS.
+         */
+        uint16_t                        rxFcsErrors;
+
+        /**
+         * Number of received frames that had been dropped because the
+         * DataBuffer-Pools were empty.
+         */
+        uint16_t                        rxNoMemory;
+
+        /**
+         * Number of received frames that had been dropped by the RX-Queue.
+         */
+        uint16_t                        rxQueueDrops;
+
+        /**
+         * Number of transmitted frames.
+         */
+        uint16_t                        txFrames;
+
+        /**
+         * Number of frames that had been dropped because a transmission
+         * was in progress.
+         */
+        uint16_t                        txDrops;
+};
+
 /**
  *  Initializes the PPP-Protocol-Stack on the Data-Link-Layer and the
  *  correspondig Physical-Layer-Module.
@@ -91,7 +141,10 @@ enum net_PPP_state_e {
 void net_PPP_init(void);
 
 /**
- *  Handles repetitive tasks within the PPP-Protocol-Stack.
+ *  Handles repetitive tasks within the PPP-Protocol-Stack. The received frames
+ *  post SCHEDULER_EVENT_PPP_RX and the end of a transmission posts
+ *  SCHEDULER_EVENT_PPP_TX (see scheduler.h). It must also be called
+ *  periodically for the flow-control and the automatic baudrate detection.
  *  @return     None.
  *  @pre        net_PPP_init has been called.
  *  @post       None.
@@ -99,17 +152,20 @@ void net_PPP_init(void);
 void net_PPP_loop(void);
 
 /**
- *  Transmits the data for the specified protocol.
+ *  Transmits the data for the specified protocol.                            @n
+ *  The PPP-Module takes the ownership of the DataBuffer-Chain and releases it
+ *  by databuffer_free after the transmission. If there is already a
+ *  transmission in progress the DataBuffer-Chain will be released immediately.
  *  @param      protocol: Protocol identifier.
  *  @param      dataBufferChain: Pointer to the first element of a
  *                               DataBuffer-Chain.
- *  @return     False if there is already a transmission in progress, true if a
- *              new transmission has been started.
+ *  @return     True if the transmission has been started, false if the
+ *              DataBuffer-Chain has been dropped.
  *  @pre        net_PPP_init has been called.
  *  @post       Process of transmission of a ppp-frame has been started if no
  *              other transmission is already in progress.
  */
-void net_PPP_txDataBuffer(enum net_PPP_protocol_e protocol,
+bool net_PPP_txDataBuffer(enum net_PPP_protocol_e protocol,
                           struct databuffer_basic_t *dataBufferChain);
 
 /**
@@ -170,6 +226,80 @@ void net_PPP_setState(enum net_PPP_state_e newState);
  */
 enum net_PPP_state_e net_PPP_getState(void);
 
+/**
+ *  Returns the baudrate of the UART-Driver. With NET_PPP_AUTOBAUD it is the
+ *  detected baudrate, the error is the difference to the baudrate of the
+ *  UART-Driver. Otherwise it is NET_PPP_BAUDRATE and its error.
+ *  @param      error: Buffer for the error of the baudrate in 1/1000 or NULL.
+ *  @return     Baudrate or 0 while the detection is in progress.
+ *  @pre        net_PPP_init has been called.
+ *  @post       None.
+ */
+uint32_t net_PPP_getBaudrate(uint16_t *error);
+
+/**
+ *  Returns and resets the maximum run-time of the interrupt service routines
+ *  of the UART-Driver, e.g. usart1_getIsrCycles.
+ *  @param      rxCyclesMax: Buffer for the maximum run-time of the
+ *                           RX-Interrupt in CPU-cycles.
+ *  @param      txCyclesMax: Buffer for the maximum run-time of the
+ *                           TX-Interrupt in CPU-cycles.
+ *  @return     None. Both values are 0 without the ISR-statistics of the
+ *              UART-Driver (e.g. USART1_ISR_STATISTICS).
+ *  @pre        net_PPP_init has been called.
+ *  @post       The maximum run-times have been reset.
+ */
+void net_PPP_getUartIsrCycles(uint16_t *rxCyclesMax, uint16_t *txCyclesMax);
+
+/**
+ *  Returns the number of Bytes that the UART-Driver has transmitted, e.g.
+ *  usart1_getTxByteCount.
+ *  @return     Number of transmitted Bytes or 0 without the TX-statistics of
+ *              the UART-Driver (e.g. USART1_TX_STATISTICS).
+ *  @pre        net_PPP_init has been called.
+ *  @post       None.
+ */
+uint32_t net_PPP_getUartTxByteCount(void);
+
+/**
+ *  Copies the counters of the PPP-Module.
+ *  @param      statistics: Buffer that will hold the counters.
+ *  @return     None.
+ *  @pre        net_PPP_init has been called.
+ *  @post       None.
+ */
+void net_PPP_getStatistics(struct net_PPP_statistics_t *statistics);
+
+/**
+ *  Sets the counters of the PPP-Module to 0.
+ *  @return     None.
+ *  @pre        net_PPP_init has been called.
+ *  @post       None.
+ */
+void net_PPP_resetStatistics(void);
+
+/**
+ *  Handles a received Byte of the UART-Driver. It is called by the interrupt
+ *  service routine, directly if it is set as RX-Handler of the UART-Driver
+ *  (e.g. USART1_RX_HANDLER), otherwise as Callback-Function.
+ *  @param      b: Received Byte.
+ *  @return     None.
+ *  @pre        net_PPP_init has been called. Interrupts are disabled.
+ *  @post       None.
+ */
+void net_PPP_rxHandler(uint8_t b);
+
+/**
+ *  Transmits the next Byte of the current frame. It is called by the
+ *  interrupt service routine when the UART-Driver can accept the next Byte,
+ *  directly if it is set as TX-Handler of the UART-Driver (e.g.
+ *  USART1_TX_HANDLER), otherwise as Callback-Function.
+ *  @return     None.
+ *  @pre        net_PPP_init has been called. Interrupts are disabled.
+ *  @post       None.
+ */
+void net_PPP_txHandler(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -1,11 +1,20 @@
 /**
  *******************************************************************************
  * @file        PPP_cfg.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Config file of the PPP-Protocol-Stack.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added NET_PPP_TX_COALESCE. (MS)
+ *                      -# Added NET_PPP_RX_QUEUE_POLICY. (MS)
+ *                      -# Added NET_PPP_RX_HIGHWATERMARK and
+ *                         NET_PPP_RX_LOWWATERMARK. (MS)
+ *                      -# Added NET_PPP_AUTOBAUD. (MS)
+ *                      -# Added NET_PPP_LOG_LEVEL. (MS)
+ *                      -# Added NET_PPP_CAPTURE. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -49,6 +58,30 @@
  */
 #define NET_PPP_BAUDRATE                (19200UL)
 
+/**
+ *  Uncomment this Define to detect the baudrate from the HDLC-Flags (0x7E)
+ *  of the remote side, NET_PPP_BAUDRATE is ignored then. The edges of the
+ *  RX-Pin are timed by the cycle-counter (see cycleCounter_cfg.h), the UART
+ *  is initialized after NET_PPP_AUTOBAUD_FLAGS matching Flags. Until then
+ *  no frames are received or transmitted.                                    @n
+ *  The range is 2400 to 115200 Baud at 16 MHz.
+ */
+//#define NET_PPP_AUTOBAUD
+
+/**
+ *  Number of the external interrupt at the RX-Pin of the UART-Driver.        @n
+ *  Possible values are:                                                      @n
+ *  0 to 3 -> INT0 to INT3 (PD0 to PD3)                                       @n
+ *  RXD1 is PD2 (INT2, Arduino Mega: Pin 19).
+ */
+#define NET_PPP_AUTOBAUD_INT            2
+
+/**
+ *  Number of Flags with the same bit-timing that are averaged.               @n
+ *  Must be 1 to 28!
+ */
+#define NET_PPP_AUTOBAUD_FLAGS          (4)
+
 /**
  *  Path of the UART-Driver.
  */
@@ -74,13 +107,58 @@
 #define NET_PPP_MTU_MAX                 (576)
 
 /**
- *  Size of the RX-Buffer in Bytes.
+ *  Maximum number of received frames waiting for net_PPP_loop.
  */
 #define NET_PPP_RX_PACKET_BUFFER_SIZE   2
 
+/**
+ *  Frame to drop if the RX-Queue is full.                                    @n
+ *  Possible values are:                                                      @n
+ *  DATABUFFER_QUEUE_DROPTAIL: drop the received frame                        @n
+ *  DATABUFFER_QUEUE_DROPHEAD: drop the oldest waiting frame
+ */
+#define NET_PPP_RX_QUEUE_POLICY         DATABUFFER_QUEUE_DROPTAIL
+
+/**
+ *  Number of waiting frames at which the remote side is stopped by the
+ *  RTS-Pin. Only used if the flow-control of the UART-Driver is enabled.
+ */
+#define NET_PPP_RX_HIGHWATERMARK        (NET_PPP_RX_PACKET_BUFFER_SIZE - 1)
+
+/**
+ *  Number of waiting frames at which the remote side may continue.
+ */
+#define NET_PPP_RX_LOWWATERMARK         (0)
+
+/**
+ *  Comment this Define to transmit the segments of a frame as they are.
+ *  Otherwise small segments are merged before the transmission starts (see
+ *  databuffer_coalesce).
+ */
+#define NET_PPP_TX_COALESCE
+
 /**
  *  Uncomment this Define to relay every received Byte via the serialConsole.
  */
 //#define NET_PPP_RELAY_INSTREAM
 
+/**
+ *  Comment this Define to remove the frame-capture (see capture.h) from the
+ *  module. Otherwise every received and transmitted frame is passed to
+ *  capture_write, which returns at once while the capture is disabled.
+ */
+#define NET_PPP_CAPTURE
+
+/**
+ *  Log-level of the module (see eventLog.h). The events of the higher levels
+ *  are removed by the compiler.                                              @n
+ *  Possible values are:                                                      @n
+ *  EVENTLOG_LEVEL_NONE                                                       @n
+ *  EVENTLOG_LEVEL_ERROR                                                      @n
+ *  EVENTLOG_LEVEL_WARNING                                                    @n
+ *  EVENTLOG_LEVEL_INFO                                                       @n
+ *  EVENTLOG_LEVEL_DEBUG
+ */
+#define NET_PPP_LOG_LEVEL               EVENTLOG_LEVEL_DEBUG
+
 #endif /* _NET_PPP_CFG_H_ */
@@ -1,13 +1,21 @@
 /**
  *******************************************************************************
  * @file        TCP.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Source file of the TCP-Protocol-Stack.
  *              This module implements the TCP-Protocol-Stack for the
  *              Transport-Layer of the OSI-Model.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# The header is parsed with a databuffer-cursor.
+ *                         (MS)
+ *                      -# The debug-output is recorded by the event-log.
+ *                         (MS)
+ *                      -# The events are filtered by NET_TCP_LOG_LEVEL.
+ *                         (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Changed from inline to macro. (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -52,7 +60,12 @@
 
 #include "..\\..\\system.h"
 #include "..\\..\\utils\\databuffer.h"
-#include "..\\..\\utils\\serialConsole.h"
+#include "..\\..\\utils\\eventLog.h"
+
+#define EVENTLOG_MODULE_LEVEL NET_TCP_LOG_LEVEL
+#include "..\\..\\utils\\eventLog_level.h"
+
+#include <string.h>
 
 #undef NET_TPC_DATALINK_FILENAME
 #define NET_TPC_DATALINK_FILENAME \
@@ -74,40 +87,18 @@
         CONCAT2(NET_TCP_INTERNET_FUNPREFIX, _setTCPRxCallback)
 
 // type-definitions
-struct tcp_header_t {
-        uint32_t raw[5];
-};
 
 
 // private function prototypes
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP);
-
-#define tcp_getSourcePort(_tcp_header_) \
-        ((uint16_t)((_tcp_header_->raw[0] >> 0) & 0x0000FFFF))
-
-#define tcp_getDestinationPort(_tcp_header_)    \
-        ((uint16_t)((_tcp_header_->raw[0] >> 16) & 0x0000FFFF))
-
-#define tcp_getSequenceNumber(_tcp_header_)     \
-        (_tcp_header_->raw[1])
-
-#define tcp_getAcknowledgeNumber(_tcp_header_)  \
-        (_tcp_header_->raw[2])
-
-#define tcp_getDataOffset(_tcp_header_) \
-        ((uint8_t)((_tcp_header_->raw[3] >> 0) & 0x0000000F))
-
-#define tcp_getControlFlags(_tcp_header_)       \
-        ((uint8_t)((_tcp_header_->raw[3] >> 8) & 0x000000FF))
-
-#define tcp_getWindow(_tcp_header_)     \
-        ((uint16_t)((_tcp_header_->raw[3] >> 16) & 0x0000FFFF))
-
-#define tcp_getChecksum(_tcp_header_)   \
-        ((uint16_t)((_tcp_header_->raw[4] >> 0) & 0x0000FFFF))
-
-#define tcp_getUrgentPointer(_tcp_header_)      \
-        ((uint16_t)((_tcp_header_->raw[4] >> 16) & 0x0000FFFF))
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_DEBUG
+static void logRx(struct databuffer_basic_t *rxDataBuffer,
+                  ipv4_t sourceIP,
+                  uint16_t sourcePort,
+                  uint16_t destinationPort,
+                  uint16_t payloadOffset,
+                  uint16_t payloadLength);
+#endif
 
 // private data
 
@@ -121,43 +112,60 @@ void net_TCP_init(void)
 // private functions
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP)
 {
-        static struct databuffer_basic_t rxDataBufferPayload;
+        struct databuffer_cursor_t cursor;
+        uint16_t sourcePort;
+        uint16_t destinationPort;
+        uint8_t dataOffset;
+        uint16_t tcpPayloadOffset;
+        uint16_t tcpLength = databuffer_getTotalLength(rxDataBuffer);
+        
+        // read the header, it may span several segments
+        databuffer_cursor_init(&cursor, rxDataBuffer, 0);
+        if (!databuffer_cursor_readU16(&cursor, &sourcePort) ||
+            !databuffer_cursor_readU16(&cursor, &destinationPort) ||
+            !databuffer_cursor_skip(&cursor, 8) ||
+            !databuffer_cursor_readU8(&cursor, &dataOffset))
+                return;
         
-        struct tcp_header_t *tcpHeader = (struct tcp_header_t *)&rxDataBuffer->data[0];
+        tcpPayloadOffset = (dataOffset >> 4) * sizeof(uint32_t);
+        if (tcpPayloadOffset > tcpLength)
+                return;
+        
+        EVENTLOG_DEBUG(logRx(rxDataBuffer,
+                             sourceIP,
+                             sourcePort,
+                             destinationPort,
+                             tcpPayloadOffset,
+                             tcpLength - tcpPayloadOffset));
+}
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_DEBUG
+static void logRx(struct databuffer_basic_t *rxDataBuffer,
+                  ipv4_t sourceIP,
+                  uint16_t sourcePort,
+                  uint16_t destinationPort,
+                  uint16_t payloadOffset,
+                  uint16_t payloadLength)
+{
+        struct databuffer_basic_t *rxDataBufferPayload;
+        uint8_t eventArgs[8];
         
-        uint16_t tcpPayloadOffset = tcp_getDataOffset(tcpHeader)
-                                    * sizeof(uint32_t);
-        uint16_t tcpPayloadLength = rxDataBuffer->length
-                                    - tcp_getDataOffset(tcpHeader)
-                                    * sizeof(uint32_t);
+        rxDataBufferPayload = databuffer_clone_partial(rxDataBuffer,
+                                                       payloadOffset,
+                                                       payloadLength);
         
-        databuffer_create(&rxDataBufferPayload,
-                          &rxDataBuffer->data[tcpPayloadOffset],
-                          tcpPayloadLength);
+        // source IP, source port and destination port
+        memcpy(&eventArgs[0], sourceIP.single, 4);
+        memcpy(&eventArgs[4], &sourcePort, 2);
+        memcpy(&eventArgs[6], &destinationPort, 2);
+        eventLog_writeChain(EVENTLOG_TCP_RX,
+                            eventArgs,
+                            sizeof(eventArgs),
+                            rxDataBufferPayload);
         
-        char singleNumber[4];
-        serialConsole_txString("\n\nrecv_TCP[");
-        itoa(IPV4_getSingle(sourceIP, 0), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 1), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 2), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 3), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString("]:");
-        itoa(tcp_getSourcePort(tcpHeader), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString("->");
-        itoa(tcp_getDestinationPort(tcpHeader), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(" = \'");
-        serialConsole_txDatabuffer(&rxDataBufferPayload);
-        serialConsole_txString("\'\n\n");
+        databuffer_free(rxDataBufferPayload);
 }
+#endif
 
 
 // interrupt service routines
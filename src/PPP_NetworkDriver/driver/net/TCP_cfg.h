@@ -1,11 +1,14 @@
 /**
  *******************************************************************************
  * @file        TCP_cfg.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Config file of the TCP-Protocol-Stack.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added NET_TCP_LOG_LEVEL. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -56,4 +59,16 @@
  */
 #define NET_TCP_INTERNET      IPV4
 
+/**
+ *  Log-level of the module (see eventLog.h). The events of the higher levels
+ *  are removed by the compiler.                                              @n
+ *  Possible values are:                                                      @n
+ *  EVENTLOG_LEVEL_NONE                                                       @n
+ *  EVENTLOG_LEVEL_ERROR                                                      @n
+ *  EVENTLOG_LEVEL_WARNING                                                    @n
+ *  EVENTLOG_LEVEL_INFO                                                       @n
+ *  EVENTLOG_LEVEL_DEBUG
+ */
+#define NET_TCP_LOG_LEVEL     EVENTLOG_LEVEL_DEBUG
+
 #endif /* _NET_TCP_CFG_H_ */
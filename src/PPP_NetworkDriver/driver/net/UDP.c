@@ -1,13 +1,21 @@
 /**
  *******************************************************************************
  * @file        UDP.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      M. Strosche
  * @brief       Source file of the UDP-Protocol-Stack.
  *              This module implements the UDP-Protocol-Stack for the
  *              Transport-Layer of the OSI-Model.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# The header is parsed with a databuffer-cursor.
+ *                         (MS)
+ *                      -# The debug-output is recorded by the event-log.
+ *                         (MS)
+ *                      -# The events are filtered by NET_UDP_LOG_LEVEL.
+ *                         (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Changed from inline to macro. (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -52,7 +60,12 @@
 
 #include "..\\..\\system.h"
 #include "..\\..\\utils\\databuffer.h"
-#include "..\\..\\utils\\serialConsole.h"
+#include "..\\..\\utils\\eventLog.h"
+
+#define EVENTLOG_MODULE_LEVEL NET_UDP_LOG_LEVEL
+#include "..\\..\\utils\\eventLog_level.h"
+
+#include <string.h>
 
 #undef NET_UDP_INTERNET_FILENAME
 #define NET_UDP_INTERNET_FILENAME \
@@ -73,28 +86,21 @@
 #define net_UDP_internet_setUDPRxCallback \
         CONCAT2(NET_UDP_INTERNET_FUNPREFIX, _setUDPRxCallback)
 
+#define NET_UDP_HEADER_LENGTH           (8)
+
 // type-definitions
-struct udp_header_t {
-        uint32_t raw[2];
-};
 
 
 // private function prototypes
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP);
-#define udp_getSourcePort(_udp_header_) \
-        ((uint16_t)((_udp_header_->raw[0] >> 0) & 0x0000FFFF))
-
-#define udp_getDestinationPort(_udp_header_)    \
-        ((uint16_t)((_udp_header_->raw[0] >> 16) & 0x0000FFFF))
-
-#define udp_getLength(_udp_header_)     \
-        ((uint16_t)((_udp_header_->raw[1] >> 0) & 0x0000FFFF))
-
-#define udp_getPayloadLength(_udp_header_)       \
-        (udp_getLength(_udp_header_) - sizeof(struct udp_header_t))
-
-#define udp_getCRC(_udp_header_)        \
-        ((uint16_t)((_udp_header_->raw[1] >> 16) & 0x0000FFFF))
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_DEBUG
+static void logRx(struct databuffer_basic_t *rxDataBuffer,
+                  ipv4_t sourceIP,
+                  uint16_t sourcePort,
+                  uint16_t destinationPort,
+                  uint16_t payloadOffset,
+                  uint16_t payloadLength);
+#endif
 
 // private data
 
@@ -109,37 +115,55 @@ void net_UDP_init(void)
 // private functions
 static void rxCallback(struct databuffer_basic_t *rxDataBuffer, ipv4_t sourceIP)
 {
-        static struct databuffer_basic_t rxDataBufferPayload;
+        struct databuffer_cursor_t cursor;
+        uint16_t sourcePort;
+        uint16_t destinationPort;
+        uint16_t length;
+        
+        // read the header, it may span several segments
+        databuffer_cursor_init(&cursor, rxDataBuffer, 0);
+        if (!databuffer_cursor_readU16(&cursor, &sourcePort) ||
+            !databuffer_cursor_readU16(&cursor, &destinationPort) ||
+            !databuffer_cursor_readU16(&cursor, &length) ||
+            (length < NET_UDP_HEADER_LENGTH) ||
+            (length > databuffer_getTotalLength(rxDataBuffer)))
+                return;
+        
+        EVENTLOG_DEBUG(logRx(rxDataBuffer,
+                             sourceIP,
+                             sourcePort,
+                             destinationPort,
+                             NET_UDP_HEADER_LENGTH,
+                             length - NET_UDP_HEADER_LENGTH));
+}
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_DEBUG
+static void logRx(struct databuffer_basic_t *rxDataBuffer,
+                  ipv4_t sourceIP,
+                  uint16_t sourcePort,
+                  uint16_t destinationPort,
+                  uint16_t payloadOffset,
+                  uint16_t payloadLength)
+{
+        struct databuffer_basic_t *rxDataBufferPayload;
+        uint8_t eventArgs[8];
         
-        struct udp_header_t *udpHeader = (struct udp_header_t *)&rxDataBuffer->data[0];
+        rxDataBufferPayload = databuffer_clone_partial(rxDataBuffer,
+                                                       payloadOffset,
+                                                       payloadLength);
         
-        databuffer_create(&rxDataBufferPayload,
-                          &rxDataBuffer->data[sizeof(struct udp_header_t)],
-                          udp_getPayloadLength(udpHeader));
+        // source IP, source port and destination port
+        memcpy(&eventArgs[0], sourceIP.single, 4);
+        memcpy(&eventArgs[4], &sourcePort, 2);
+        memcpy(&eventArgs[6], &destinationPort, 2);
+        eventLog_writeChain(EVENTLOG_UDP_RX,
+                            eventArgs,
+                            sizeof(eventArgs),
+                            rxDataBufferPayload);
         
-        char singleNumber[8];
-        serialConsole_txString("\n\nrecv_UDP[");
-        itoa(IPV4_getSingle(sourceIP, 0), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 1), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 2), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(".");
-        itoa(IPV4_getSingle(sourceIP, 3), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString("]:");
-        itoa(udp_getSourcePort(udpHeader), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString("->");
-        itoa(udp_getDestinationPort(udpHeader), singleNumber, 10);
-        serialConsole_txString(singleNumber);
-        serialConsole_txString(" = \'");
-        serialConsole_txDatabuffer(&rxDataBufferPayload);
-        serialConsole_txString("\'\n\n");
+        databuffer_free(rxDataBufferPayload);
 }
+#endif
 
 
 // interrupt service routines
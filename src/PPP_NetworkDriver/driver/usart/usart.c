@@ -0,0 +1,245 @@
+/**
+ *******************************************************************************
+ * @file        usart.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the common driver for the internal
+ *              USART-peripheries.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "usart.h"
+
+#include "..\\..\\system.h"
+
+#include <util/atomic.h>
+
+// private function prototypes
+static uint16_t calculateError(uint32_t cycles, uint32_t cyclesReal);
+static void dummyRxCallback(uint8_t b);
+static void dummyTxCallback(void);
+
+// external definitions of the inline functions
+extern inline void usart_txInterrupt(struct usart_t *usart,
+                                     const struct usart_description_t *description,
+                                     void (*callback)(void));
+extern inline void usart_updateIsrCycles(volatile uint16_t *cyclesMax,
+                                         uint16_t start);
+
+// public functions
+void usart_init(struct usart_t *usart, uint16_t ubrr)
+{
+        const struct usart_description_t *description = usart->description;
+
+        if (usart->rxFinishedCallback == NULL)
+                usart->rxFinishedCallback = dummyRxCallback;
+        if (usart->txFinishedCallback == NULL)
+                usart->txFinishedCallback = dummyTxCallback;
+
+        usart->txBufferLength = 0;
+        usart->txIsPaused = false;
+        usart->txByteCount = 0;
+        usart->rxIsrCyclesMax = 0;
+        usart->txIsrCyclesMax = 0;
+
+        if (description->options & USART_OPTION_ISR_STATISTICS)
+                cycleCounter_init();
+
+        // Set gpio-pins
+        *description->txdDdr |= description->txdMask;
+        if (description->options & USART_OPTION_FLOWCONTROL) {
+                // RTS is LOW (ready), CTS has a pull-up
+                *description->rtsDdr |= description->rtsMask;
+                *description->rtsPort &= ~description->rtsMask;
+                *description->ctsDdr &= ~description->ctsMask;
+                *description->ctsPort |= description->ctsMask;
+        }
+
+        // Set USART-Registers
+        *description->ucsra = 0;
+        *description->ucsrb = description->frameFormatB;
+        *description->ucsrc = description->frameFormat;
+
+        if (ubrr & USART_UBRR_U2X)
+                *description->ucsra |= (1 << U2X0);
+        *description->ubrr = ubrr & ~USART_UBRR_U2X;
+
+        // Enable RX and TX
+        *description->ucsrb |=  (1 << RXEN0) | (1 << TXEN0);
+        if (description->options & USART_OPTION_TX_UDRE)
+                // Enable RX interrupt, the UDRE interrupt is enabled by txByte
+                *description->ucsrb |=  (1 << RXCIE0);
+        else
+                // Enable RX and TX interrupts
+                *description->ucsrb |=  (1 << RXCIE0) | (1 << TXCIE0);
+}
+
+uint16_t usart_calculateUbrr(uint32_t cycles,
+                             uint8_t numberOfBits,
+                             uint16_t *error)
+{
+        uint32_t ubrrNormal;
+        uint32_t ubrrU2x;
+        uint16_t errorNormal;
+        uint16_t errorU2x;
+
+        // 16 (normal) or 8 (double-speed) samples per Bit, rounded
+        ubrrNormal = (cycles + 8UL * numberOfBits) / (16UL * numberOfBits) - 1;
+        ubrrU2x = (cycles + 4UL * numberOfBits) / (8UL * numberOfBits) - 1;
+        if (ubrrNormal > USART_UBRR_MAX)
+                ubrrNormal = USART_UBRR_MAX;
+        errorNormal = calculateError(cycles,
+                                     16UL * numberOfBits * (ubrrNormal + 1));
+        errorU2x = calculateError(cycles,
+                                  8UL * numberOfBits * (ubrrU2x + 1));
+
+        if ((ubrrU2x <= USART_UBRR_MAX) && (errorU2x < errorNormal)) {
+                if (error != NULL)
+                        *error = errorU2x;
+                return (uint16_t)ubrrU2x | USART_UBRR_U2X;
+        }
+
+        if (error != NULL)
+                *error = errorNormal;
+        return (uint16_t)ubrrNormal;
+}
+
+void usart_setRxFinishedCallback(struct usart_t *usart,
+                                 void (*callback)(uint8_t b))
+{
+        if (callback != NULL)
+                usart->rxFinishedCallback = callback;
+}
+
+void usart_setTxFinishedCallback(struct usart_t *usart,
+                                 void (*callback)(void))
+{
+        if (callback != NULL)
+                usart->txFinishedCallback = callback;
+}
+
+void usart_txBuffer(struct usart_t *usart,
+                    const uint8_t *buffer,
+                    uint16_t length)
+{
+        const struct usart_description_t *description = usart->description;
+
+        if (length == 0)
+                return;
+
+        usart->txBuffer = buffer + 1;
+        usart->txBufferLength = length - 1;
+
+        *description->udr = buffer[0];
+        if (description->options & USART_OPTION_TX_UDRE)
+                *description->ucsrb |= (1 << UDRIE0);
+}
+
+void usart_setRts(struct usart_t *usart, bool isReady)
+{
+        const struct usart_description_t *description = usart->description;
+
+        if (!(description->options & USART_OPTION_FLOWCONTROL))
+                return;
+
+        if (isReady)
+                *description->rtsPort &= ~description->rtsMask;
+        else
+                *description->rtsPort |= description->rtsMask;
+}
+
+void usart_checkCts(struct usart_t *usart)
+{
+        const struct usart_description_t *description = usart->description;
+
+        if (!(description->options & USART_OPTION_FLOWCONTROL))
+                return;
+
+        if (usart->txIsPaused &&
+            !(*description->ctsPin & description->ctsMask)) {
+                usart->txIsPaused = false;
+                if (description->options & USART_OPTION_TX_UDRE) {
+                        // the data-register is empty, the interrupt occurs at once
+                        *description->ucsrb |= (1 << UDRIE0);
+                } else {
+                        void (*callback)(void) = description->txHandler;
+
+                        if (callback == NULL)
+                                callback = usart->txFinishedCallback;
+                        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                                usart_txInterrupt(usart, description, callback);
+                        }
+                }
+        }
+}
+
+uint32_t usart_getTxByteCount(struct usart_t *usart)
+{
+        uint32_t count;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                count = usart->txByteCount;
+        }
+
+        return count;
+}
+
+void usart_getIsrCycles(struct usart_t *usart,
+                        uint16_t *rxCyclesMax,
+                        uint16_t *txCyclesMax)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                *rxCyclesMax = usart->rxIsrCyclesMax;
+                *txCyclesMax = usart->txIsrCyclesMax;
+                usart->rxIsrCyclesMax = 0;
+                usart->txIsrCyclesMax = 0;
+        }
+}
+
+// private functions
+static uint16_t calculateError(uint32_t cycles, uint32_t cyclesReal)
+{
+        uint32_t difference = (cycles > cyclesReal) ? (cycles - cyclesReal) :
+                                                      (cyclesReal - cycles);
+
+        // the error of the duration equals the error of the baudrate
+        return (uint16_t)(difference * 1000UL / cycles);
+}
+
+static void dummyRxCallback(uint8_t b)
+{
+        UNUSED_ARG(b);
+}
+
+static void dummyTxCallback(void) {}
@@ -0,0 +1,645 @@
+/**
+ *******************************************************************************
+ * @file        usart.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the common driver for the internal
+ *              USART-peripheries.
+ *              Every USART-periphery is described by a constant
+ *              usart_description_t and handled by a usart_t. The instances
+ *              usart0 to usart3 are generated by USART_DECLARE_INSTANCE and
+ *              USART_DEFINE_INSTANCE, their functions (e.g. usart1_init) only
+ *              forward to the common functions of this module. The functions
+ *              that are called for every Byte access the registers directly.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _USART_H_
+#define _USART_H_
+
+#include "..\\..\\system.h"
+#include "..\\..\\utils\\cycleCounter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+        #error F_CPU must be defined to calculate the baudrate
+#endif /* F_CPU */
+
+/**
+ *  Option: transmit with the Data-Register-Empty-Interrupt.
+ */
+#define USART_OPTION_TX_UDRE            (0x01)
+
+/**
+ *  Option: count the transmitted Bytes.
+ */
+#define USART_OPTION_TX_STATISTICS      (0x02)
+
+/**
+ *  Option: hardware flow-control (RTS/CTS).
+ */
+#define USART_OPTION_FLOWCONTROL        (0x04)
+
+/**
+ *  Option: measure the maximum run-time of the interrupt service routines
+ *  with the cycle-counter.
+ */
+#define USART_OPTION_ISR_STATISTICS     (0x08)
+
+/**
+ *  Flag of the value of USART_UBRR that selects double-speed (U2X).
+ */
+#define USART_UBRR_U2X                  (0x8000)
+
+/**
+ *  Maximum value of the UBRR-Register.
+ */
+#define USART_UBRR_MAX                  (4095UL)
+
+/**
+ *  Calculates the rounded value of the UBRR-Register in normal mode.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_UBRR_NORMAL(_baudrate_) \
+        (((F_CPU) + 8UL * (_baudrate_)) / (16UL * (_baudrate_)) - 1UL)
+
+/**
+ *  Calculates the rounded value of the UBRR-Register in double-speed mode.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_UBRR_U2XMODE(_baudrate_) \
+        (((F_CPU) + 4UL * (_baudrate_)) / (8UL * (_baudrate_)) - 1UL)
+
+/**
+ *  Calculates the error of a real baudrate in 1/1000.
+ *  The Parameters are:
+ *      -# real: Baudrate that results from the UBRR-Register.
+ *      -# baudrate: Requested baudrate.
+ */
+#define USART_BAUDRATE_ERROR(_real_, _baudrate_)                   \
+        ((((_real_) > (_baudrate_)) ? ((_real_) - (_baudrate_)) :  \
+                                      ((_baudrate_) - (_real_))) * \
+         1000UL / (_baudrate_))
+
+/**
+ *  Calculates the error of the baudrate in normal mode in 1/1000.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_BAUDRATE_ERROR_NORMAL(_baudrate_)                              \
+        USART_BAUDRATE_ERROR((F_CPU) /                                       \
+                             (16UL * (USART_UBRR_NORMAL(_baudrate_) + 1UL)), \
+                             _baudrate_)
+
+/**
+ *  Calculates the error of the baudrate in double-speed mode in 1/1000.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_BAUDRATE_ERROR_U2XMODE(_baudrate_)                             \
+        USART_BAUDRATE_ERROR((F_CPU) /                                       \
+                             (8UL * (USART_UBRR_U2XMODE(_baudrate_) + 1UL)), \
+                             _baudrate_)
+
+/**
+ *  Checks if the double-speed mode gives the lower error. The normal mode is
+ *  preferred at equal errors because the receiver samples each Bit more
+ *  often.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_USE2X(_baudrate_)                                \
+        ((USART_UBRR_U2XMODE(_baudrate_) <= USART_UBRR_MAX) && \
+         ((USART_UBRR_NORMAL(_baudrate_) > USART_UBRR_MAX) ||  \
+          (USART_BAUDRATE_ERROR_U2XMODE(_baudrate_) <          \
+           USART_BAUDRATE_ERROR_NORMAL(_baudrate_))))
+
+/**
+ *  Calculates the error of the baudrate in 1/1000 for the selected mode.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ */
+#define USART_BAUDRATE_ERROR_SELECTED(_baudrate_)                             \
+        (USART_USE2X(_baudrate_) ? USART_BAUDRATE_ERROR_U2XMODE(_baudrate_) : \
+                                   USART_BAUDRATE_ERROR_NORMAL(_baudrate_))
+
+/**
+ *  Calculates the value for usart_init: the rounded value of the
+ *  UBRR-Register and USART_UBRR_U2X if the double-speed mode gives the lower
+ *  error.                                                                    @n
+ *  The build fails if the baudrate is not constant or its error exceeds
+ *  the limit.
+ *  The Parameters are:
+ *      -# baudrate: Baudrate.
+ *      -# errorMax: Maximum error in 1/1000.
+ */
+#define USART_UBRR(_baudrate_, _errorMax_)                                  \
+        ((uint16_t)(USART_USE2X(_baudrate_) ?                               \
+                    (USART_UBRR_U2XMODE(_baudrate_) | USART_UBRR_U2X) :     \
+                    USART_UBRR_NORMAL(_baudrate_)) +                        \
+         0 * BUILD_BUG_ON_ZERO((USART_BAUDRATE_ERROR_SELECTED(_baudrate_) > \
+                                (_errorMax_)) ||                            \
+                               (USART_UBRR_NORMAL(_baudrate_) >             \
+                                USART_UBRR_MAX)))
+
+/**
+ *  Calculates the value of the UCSZ-Bits for a number of data-bits.
+ *  The Parameters are:
+ *      -# databits: Number of data-bits [5, 9].
+ */
+#define USART_DATABITS_REGVAL(_databits_) \
+        ((_databits_) - 5 + (((_databits_) / 9) * 3))
+
+/**
+ *  Calculates the frame-format of the UCSRC-Register. The build fails if the
+ *  number of data-bits is not in [5, 9].
+ *  The Parameters are:
+ *      -# databits: Number of data-bits [5, 9].
+ *      -# parity: Parity-Mode (0: none, 2: even, 3: odd).
+ *      -# stopbits: 0 for 1 Stop-Bit, 1 for 2 Stop-Bits.
+ */
+#define USART_FRAMEFORMAT(_databits_, _parity_, _stopbits_)                   \
+        ((uint8_t)(((_parity_) << UPM00) |                                    \
+                   ((_stopbits_) << USBS0) |                                  \
+                   ((USART_DATABITS_REGVAL(_databits_) & 0x03) << UCSZ00)) + \
+         0 * BUILD_BUG_ON_ZERO(((_databits_) < 5) || ((_databits_) > 9)))
+
+/**
+ *  Calculates the frame-format-bit of the UCSRB-Register (UCSZ2).
+ *  The Parameters are:
+ *      -# databits: Number of data-bits [5, 9].
+ */
+#define USART_FRAMEFORMATB(_databits_) \
+        (((USART_DATABITS_REGVAL(_databits_) & 0x04) >> 2) << UCSZ02)
+
+/**
+ *  This structure describes the registers, pins and options of a
+ *  USART-periphery. The Bit-Positions within the registers are the same for
+ *  all USART-peripheries, the names of USART0 are used (e.g. RXEN0).
+ */
+struct usart_description_t {
+        volatile uint8_t               *ucsra;
+        volatile uint8_t               *ucsrb;
+        volatile uint8_t               *ucsrc;
+        volatile uint16_t              *ubrr;
+        volatile uint8_t               *udr;
+
+        /**
+         * Data-Direction-Register and Bit-Mask of the TXD-Pin.
+         */
+        volatile uint8_t               *txdDdr;
+        uint8_t                         txdMask;
+
+        /**
+         * Registers and Bit-Masks of the RTS- and CTS-Pins.
+         */
+        volatile uint8_t               *rtsDdr;
+        volatile uint8_t               *rtsPort;
+        uint8_t                         rtsMask;
+        volatile uint8_t               *ctsDdr;
+        volatile uint8_t               *ctsPort;
+        volatile uint8_t               *ctsPin;
+        uint8_t                         ctsMask;
+
+        /**
+         * Value of the UCSRC-Register (frame-format).
+         */
+        uint8_t                         frameFormat;
+
+        /**
+         * Value of the UCSZ2-Bit of the UCSRB-Register.
+         */
+        uint8_t                         frameFormatB;
+
+        /**
+         * Options (see USART_OPTION_*).
+         */
+        uint8_t                         options;
+
+        /**
+         * Handler that is called directly by the interrupt service routines
+         * instead of the Callback-Function (TX) or NULL.
+         */
+        void                          (*txHandler)(void);
+};
+
+/**
+ *  This structure holds the state of a USART-periphery.
+ */
+struct usart_t {
+        const struct usart_description_t *description;
+        void (*rxFinishedCallback)(uint8_t b);
+        void (*txFinishedCallback)(void);
+
+        /**
+         * Remaining Bytes of usart_txBuffer.
+         */
+        const uint8_t * volatile        txBuffer;
+        volatile uint16_t               txBufferLength;
+
+        /**
+         * Set if the transmission has been paused by the CTS-Pin.
+         */
+        volatile bool                   txIsPaused;
+
+        /**
+         * Number of transmitted Bytes (USART_OPTION_TX_STATISTICS).
+         */
+        volatile uint32_t               txByteCount;
+
+        /**
+         * Maximum run-time of the interrupt service routines in CPU-cycles
+         * (USART_OPTION_ISR_STATISTICS).
+         */
+        volatile uint16_t               rxIsrCyclesMax;
+        volatile uint16_t               txIsrCyclesMax;
+};
+
+/**
+ *  Initializes a USART-periphery.
+ *  @param      usart: USART-periphery.
+ *  @param      ubrr: Value of the UBRR-Register, USART_UBRR_U2X selects the
+ *              double-speed mode (see USART_UBRR).
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The USART-periphery has been initialized.
+ */
+void usart_init(struct usart_t *usart, uint16_t ubrr);
+
+/**
+ *  Calculates the value for usart_init at run-time from a measured duration,
+ *  e.g. of an automatic baudrate detection. Like USART_UBRR the double-speed
+ *  mode is selected if it gives the lower error.
+ *  @param      cycles: Measured duration of numberOfBits Bits in CPU-cycles.
+ *  @param      numberOfBits: Number of Bits of the measured duration.
+ *  @param      error: Buffer for the error of the resulting baudrate in 1/1000
+ *                     or NULL.
+ *  @return     Value of the UBRR-Register, USART_UBRR_U2X selects the
+ *              double-speed mode.
+ *  @pre        cycles is at least 16 * numberOfBits.
+ *  @post       None.
+ */
+uint16_t usart_calculateUbrr(uint32_t cycles,
+                             uint8_t numberOfBits,
+                             uint16_t *error);
+
+/**
+ *  Sets the Callback-Function that will be called each time a new Byte has been
+ *  received.
+ *  @param      usart: USART-periphery.
+ *  @param      callback: Callback-Function of type void:uint8.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       Callback-Function has been set.
+ */
+void usart_setRxFinishedCallback(struct usart_t *usart,
+                                 void (*callback)(uint8_t b));
+
+/**
+ *  Sets the Callback-Function that will be called each time a Byte has been
+ *  transmitted. With USART_OPTION_TX_UDRE it is called as soon as the next
+ *  Byte can be written, i.e. while the last Byte is still shifted out.
+ *  @param      usart: USART-periphery.
+ *  @param      callback: Callback-Function of type void:void.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       Callback-Function has been set.
+ */
+void usart_setTxFinishedCallback(struct usart_t *usart,
+                                 void (*callback)(void));
+
+/**
+ *  Starts the transmission of a buffer. The Bytes are written by the
+ *  interrupt service routine without calling the Callback-Function (TX) in
+ *  between.                                                                  @n
+ *  After the transmission of the last Byte the set Callback-Function (TX)
+ *  will be called.
+ *  @param      usart: USART-periphery.
+ *  @param      buffer: Bytes to transmit.
+ *  @param      length: Number of Bytes.
+ *  @return     None.
+ *  @pre        The function usart_init had been called and no transmission
+ *              is in progress. The buffer stays valid until the
+ *              Callback-Function (TX) is called.
+ *  @post       The transmission of the buffer has started.
+ */
+void usart_txBuffer(struct usart_t *usart,
+                    const uint8_t *buffer,
+                    uint16_t length);
+
+/**
+ *  Allows or stops the transmission of the remote side by the RTS-Pin.       @n
+ *  Without USART_OPTION_FLOWCONTROL this function does nothing.
+ *  @param      usart: USART-periphery.
+ *  @param      isReady: True if further Bytes can be received.
+ *  @return     None.
+ *  @pre        The function usart_init had been called.
+ *  @post       The RTS-Pin has been set.
+ */
+void usart_setRts(struct usart_t *usart, bool isReady);
+
+/**
+ *  Resumes a transmission that has been paused by the CTS-Pin. This function
+ *  must be called periodically, e.g. from the main loop.                     @n
+ *  Without USART_OPTION_FLOWCONTROL this function does nothing.
+ *  @param      usart: USART-periphery.
+ *  @return     None.
+ *  @pre        The function usart_init had been called.
+ *  @post       The transmission continues if the CTS-Pin is LOW.
+ */
+void usart_checkCts(struct usart_t *usart);
+
+/**
+ *  Returns the number of Bytes that had been transmitted since usart_init.
+ *  Together with a time-base this gives the effective throughput.
+ *  @param      usart: USART-periphery.
+ *  @return     Number of transmitted Bytes or 0 without
+ *              USART_OPTION_TX_STATISTICS.
+ *  @pre        The function usart_init had been called.
+ *  @post       None.
+ */
+uint32_t usart_getTxByteCount(struct usart_t *usart);
+
+/**
+ *  Returns and resets the maximum run-time of the interrupt service routines
+ *  since usart_init or the last call. The run-time is measured from the
+ *  first to the last statement of the routine, the saving and restoring of
+ *  the registers by the compiler (prologue and epilogue) is not included.
+ *  @param      usart: USART-periphery.
+ *  @param      rxCyclesMax: Buffer for the maximum run-time of the
+ *                           RX-Interrupt in CPU-cycles.
+ *  @param      txCyclesMax: Buffer for the maximum run-time of the
+ *                           UDRE- or TX-Interrupt in CPU-cycles.
+ *  @return     None. Both values are 0 without USART_OPTION_ISR_STATISTICS.
+ *  @pre        The function usart_init had been called.
+ *  @post       The maximum run-times have been reset.
+ */
+void usart_getIsrCycles(struct usart_t *usart,
+                        uint16_t *rxCyclesMax,
+                        uint16_t *txCyclesMax);
+
+/**
+ *  Handles the TX-Interrupt: continues usart_txBuffer or calls the
+ *  Callback-Function (TX).                                                   @n
+ *  This function is called by the interrupt service routines. If the
+ *  description is a constant all register accesses are resolved at
+ *  compile-time.
+ *  @param      usart: USART-periphery.
+ *  @param      description: Description of the USART-periphery.
+ *  @param      callback: Callback-Function (TX) or the handler of the
+ *                        instance. A constant function is called directly.
+ *  @return     None.
+ *  @pre        Interrupts are disabled.
+ *  @post       None.
+ */
+inline void usart_txInterrupt(struct usart_t *usart,
+                              const struct usart_description_t *description,
+                              void (*callback)(void))
+{
+        if ((description->options & USART_OPTION_FLOWCONTROL) &&
+            (*description->ctsPin & description->ctsMask)) {
+                // the remote side is busy, usart_checkCts resumes
+                usart->txIsPaused = true;
+                if (description->options & USART_OPTION_TX_UDRE)
+                        *description->ucsrb &= ~(1 << UDRIE0);
+                return;
+        }
+
+        if (description->options & USART_OPTION_TX_STATISTICS)
+                usart->txByteCount++;
+
+        if (usart->txBufferLength > 0) {
+                // continue the transmission of the buffer
+                usart->txBufferLength--;
+                *description->udr = *usart->txBuffer++;
+        } else {
+                // the next call of txByte enables the interrupt again
+                if (description->options & USART_OPTION_TX_UDRE)
+                        *description->ucsrb &= ~(1 << UDRIE0);
+                callback();
+        }
+}
+
+/**
+ *  Updates the maximum run-time of an interrupt service routine.
+ *  @param      cyclesMax: Maximum run-time in CPU-cycles.
+ *  @param      start: Value of cycleCounter_read at the start of the routine.
+ *  @return     None.
+ *  @pre        Interrupts are disabled.
+ *  @post       None.
+ */
+inline void usart_updateIsrCycles(volatile uint16_t *cyclesMax, uint16_t start)
+{
+        uint16_t cycles = cycleCounter_elapsed(start);
+
+        if (cycles > *cyclesMax)
+                *cyclesMax = cycles;
+}
+
+/**
+ *  Declares the functions of the instance usart<n> (e.g. usart1_txByte).
+ *  This macro is used by the header-file of the instance.
+ *  The Parameters are:
+ *      -# n: Number of the USART-periphery (0, 1, 2, 3).
+ *  @pre        USART<n>_OPTIONS is defined.
+ */
+#define USART_DECLARE_INSTANCE(_n_)                                              \
+        extern struct usart_t CONCAT3(usart, _n_, _instance);                    \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _initUbrr)(uint16_t ubrr)                \
+        {                                                                        \
+                usart_init(&CONCAT3(usart, _n_, _instance), ubrr);               \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _setRxFinishedCallback)(                 \
+                void (*callback)(uint8_t b))                                     \
+        {                                                                        \
+                usart_setRxFinishedCallback(&CONCAT3(usart, _n_, _instance),     \
+                                            callback);                           \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _setTxFinishedCallback)(                 \
+                void (*callback)(void))                                          \
+        {                                                                        \
+                usart_setTxFinishedCallback(&CONCAT3(usart, _n_, _instance),     \
+                                            callback);                           \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _txByte)(uint8_t b)                      \
+        {                                                                        \
+                CONCAT2(UDR, _n_) = b;                                           \
+                if (CONCAT3(USART, _n_, _OPTIONS) & USART_OPTION_TX_UDRE)        \
+                        CONCAT3(UCSR, _n_, B) |= (1 << UDRIE0);                  \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _txBuffer)(const uint8_t *buffer,        \
+                                                   uint16_t length)              \
+        {                                                                        \
+                usart_txBuffer(&CONCAT3(usart, _n_, _instance), buffer, length); \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _setRts)(bool isReady)                   \
+        {                                                                        \
+                if (CONCAT3(USART, _n_, _OPTIONS) & USART_OPTION_FLOWCONTROL)    \
+                        usart_setRts(&CONCAT3(usart, _n_, _instance), isReady);  \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _checkCts)(void)                         \
+        {                                                                        \
+                if (CONCAT3(USART, _n_, _OPTIONS) & USART_OPTION_FLOWCONTROL)    \
+                        usart_checkCts(&CONCAT3(usart, _n_, _instance));         \
+        }                                                                        \
+                                                                                 \
+        inline uint32_t CONCAT3(usart, _n_, _getTxByteCount)(void)               \
+        {                                                                        \
+                return usart_getTxByteCount(&CONCAT3(usart, _n_, _instance));    \
+        }                                                                        \
+                                                                                 \
+        inline void CONCAT3(usart, _n_, _getIsrCycles)(uint16_t *rxCyclesMax,    \
+                                                       uint16_t *txCyclesMax)    \
+        {                                                                        \
+                usart_getIsrCycles(&CONCAT3(usart, _n_, _instance),              \
+                                   rxCyclesMax,                                  \
+                                   txCyclesMax);                                 \
+        }
+
+/**
+ *  Defines the description, the state and the interrupt service routines of
+ *  the instance usart<n>. This macro is used by the source-file of the
+ *  instance.                                                                 @n
+ *  The frame-format is calculated from USART<n>_DATABITS, USART<n>_PARITY
+ *  and USART<n>_STOPBITS of usart<n>_cfg.h.                                  @n
+ *  The interrupt service routines call USART<n>_RX_CALLBACK and
+ *  USART<n>_TX_CALLBACK of usart<n>.h. They are either the Callback-Functions
+ *  of the state or the handlers of usart<n>_cfg.h, which are called directly
+ *  and can be inlined by the compiler (LTO). The routines do not enable the
+ *  interrupts, so they are not nested.
+ *  The Parameters are:
+ *      -# n: Number of the USART-periphery (0, 1, 2, 3).
+ *      -# port: Letter of the Port of the TXD-Pin (D, E, ...).
+ *      -# txd: Number of the TXD-Pin.
+ *  @pre        usart<n>.h and usart<n>_cfg.h are included.
+ */
+#define USART_DEFINE_INSTANCE(_n_, _port_, _txd_)                          \
+        static const struct usart_description_t description = {            \
+                .ucsra = &CONCAT3(UCSR, _n_, A),                           \
+                .ucsrb = &CONCAT3(UCSR, _n_, B),                           \
+                .ucsrc = &CONCAT3(UCSR, _n_, C),                           \
+                .ubrr = &CONCAT2(UBRR, _n_),                               \
+                .udr = &CONCAT2(UDR, _n_),                                 \
+                .txdDdr = &CONCAT2(DDR, _port_),                           \
+                .txdMask = BV(_txd_),                                      \
+                .rtsDdr = &CONCAT2(DDR, CONCAT3(USART, _n_, _RTS_PORT)),   \
+                .rtsPort = &CONCAT2(PORT, CONCAT3(USART, _n_, _RTS_PORT)), \
+                .rtsMask = BV(CONCAT3(USART, _n_, _RTS_PIN)),              \
+                .ctsDdr = &CONCAT2(DDR, CONCAT3(USART, _n_, _CTS_PORT)),   \
+                .ctsPort = &CONCAT2(PORT, CONCAT3(USART, _n_, _CTS_PORT)), \
+                .ctsPin = &CONCAT2(PIN, CONCAT3(USART, _n_, _CTS_PORT)),   \
+                .ctsMask = BV(CONCAT3(USART, _n_, _CTS_PIN)),              \
+                .frameFormat = USART_FRAMEFORMAT(                          \
+                        CONCAT3(USART, _n_, _DATABITS),                    \
+                        CONCAT3(USART, _n_, _PARITY),                      \
+                        CONCAT3(USART, _n_, _STOPBITS)),                   \
+                .frameFormatB = USART_FRAMEFORMATB(                        \
+                        CONCAT3(USART, _n_, _DATABITS)),                   \
+                .options = CONCAT3(USART, _n_, _OPTIONS),                  \
+                .txHandler = CONCAT3(USART, _n_, _TX_HANDLER_OR_NULL),     \
+        };                                                                 \
+                                                                           \
+        struct usart_t CONCAT3(usart, _n_, _instance) = {                  \
+                .description = &description,                               \
+        };                                                                 \
+                                                                           \
+        ISR(CONCAT3(USART, _n_, _RX_vect))                                 \
+        {                                                                  \
+                uint16_t start = 0;                                        \
+                                                                           \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        start = cycleCounter_read();                       \
+                CONCAT3(USART, _n_, _RX_CALLBACK)(CONCAT2(UDR, _n_));      \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        usart_updateIsrCycles(                             \
+                                &CONCAT3(usart, _n_, _instance)            \
+                                        .rxIsrCyclesMax,                   \
+                                start);                                    \
+        }                                                                  \
+                                                                           \
+        ISR(CONCAT3(USART, _n_, _UDRE_vect))                               \
+        {                                                                  \
+                uint16_t start = 0;                                        \
+                                                                           \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        start = cycleCounter_read();                       \
+                usart_txInterrupt(&CONCAT3(usart, _n_, _instance),         \
+                                  &description,                            \
+                                  CONCAT3(USART, _n_, _TX_CALLBACK));      \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        usart_updateIsrCycles(                             \
+                                &CONCAT3(usart, _n_, _instance)            \
+                                        .txIsrCyclesMax,                   \
+                                start);                                    \
+        }                                                                  \
+                                                                           \
+        ISR(CONCAT3(USART, _n_, _TX_vect))                                 \
+        {                                                                  \
+                uint16_t start = 0;                                        \
+                                                                           \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        start = cycleCounter_read();                       \
+                usart_txInterrupt(&CONCAT3(usart, _n_, _instance),         \
+                                  &description,                            \
+                                  CONCAT3(USART, _n_, _TX_CALLBACK));      \
+                if (CONCAT3(USART, _n_, _OPTIONS) &                        \
+                    USART_OPTION_ISR_STATISTICS)                           \
+                        usart_updateIsrCycles(                             \
+                                &CONCAT3(usart, _n_, _instance)            \
+                                        .txIsrCyclesMax,                   \
+                                start);                                    \
+        }
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _USART_H_ */
@@ -1,11 +1,23 @@
 /**
  *******************************************************************************
  * @file        usart0.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Source-file for the internal USART0-periphery.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Optional transmission with the Data-Register-
+ *                         Empty-Interrupt (USART0_TX_UDRE). (MS)
+ *                      -# Added usart0_txBuffer and usart0_getTxByteCount. (MS)
+ *                      -# Optional hardware flow-control (USART0_FLOWCONTROL).
+ *                         (MS)
+ *                      -# Generated by USART_DEFINE_INSTANCE of usart.h.
+ *                         (MS)
+ *                      -# Optional direct call of the RX-/TX-Handlers. (MS)
+ *                      -# Compiled only with USART0_ENABLE, the frame-format
+ *                         is calculated by USART_DEFINE_INSTANCE. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Tabs to spaces. (MS)
  *                      -# Use of UNUSED_ARG in dummyTxCallback. (MS)
@@ -50,106 +62,14 @@
 #include "usart0_cfg.h"
 
 #include "..\\..\\system.h"
-#include "..\\gpio\\gpio.h"
 
-#ifdef F_CPU
-        //#define USART0_BAUD(_speed_) ((F_CPU+_speed_*8UL)/(_speed_*16UL)-1UL)
-        #define USART0_BAUD1(_speed_) ((F_CPU/(_speed_*16UL))-1UL)
-        #define USART0_BAUD2(_speed_) ((F_CPU/(_speed_*8UL))-1UL)
-#else
-        #error F_CPU must be defined to calculate the baudrate
-#endif /* F_CPU */
+#ifdef USART0_ENABLE
 
-#ifdef __AVR_ATmega2560__
-        #define USART0_RXD_PORT E
-        #define USART0_RXD      (0)
-        #define USART0_TXD_PORT E
-        #define USART0_TXD      (1)
-#else
+#ifndef __AVR_ATmega2560__
         #error "undefined processor"
 #endif
 
-#if USART0_DATABITS == USART0_DATABITS_9
-        #error "9th databit currently not supported"
-#endif
-
-#if (USART0_DATABITS < 5) || (USART0_DATABITS > 9)
-        #error "Illegal setting of USART0_DATABITS! Sould be [5, 9]."
-#endif
-
-#define USART0_DATABITS_REGVAL  \
-        (USART0_DATABITS - 5 + ((USART0_DATABITS / 9) * 3))
-
-// private function prototypes
-static void dummyRxCallback(uint8_t b);
-static void dummyTxCallback(void);
-
-// data
-static void (*rxFinishedCallback)(uint8_t b) = dummyRxCallback;
-static void (*txFinishedCallback)(void) = dummyTxCallback;
-
-// public functions
-void usart0_init(uint32_t baudrate)
-{
-        // Set gpio-pins
-        gpio_setPinAsOutput(USART0_RXD_PORT, USART0_RXD);
-        gpio_setPinAsOutput(USART0_TXD_PORT, USART0_TXD);
-        
-        // Set USART0-Registers
-        UCSR0A = 0;
-        UCSR0B = 0;
-        UCSR0C = 0;
-        
-        UCSR0C |= (USART0_PARITY << UPM00);
-        UCSR0C |= (USART0_STOPBITS << USBS0);
-        UCSR0C |= ((USART0_DATABITS_REGVAL & 0x03) << UCSZ00);
-        UCSR0B |= (((USART0_DATABITS_REGVAL & 0x04) >> 2) << UCSZ02);
-  
-#ifdef USART0_USE2X
-        UCSR0A |= (1 << U2X0);
-        UBRR0 = USART0_BAUD2(baudrate);
-#else
-        UBRR0 = USART0_BAUD1(baudrate);
-#endif /* USART0_USE2X */
-        
-        // Enable RX and TX
-        UCSR0B |=  (1 << RXEN0) | (1 << TXEN0);
-        // Enable RX and TX interrupts
-        UCSR0B |=  (1 << RXCIE0) | (1 << TXCIE0);
-}
-
-void usart0_setRxFinishedCallback(void (*callback)(uint8_t b))
-{
-        if (callback != NULL)
-                rxFinishedCallback = callback;
-}
-
-void usart0_setTxFinishedCallback(void (*callback)(void))
-{
-        if (callback != NULL)
-                txFinishedCallback = callback;
-}
-
-// private functions
-static void dummyRxCallback(uint8_t b)
-{
-        UNUSED_ARG(b);
-}
-
-static void dummyTxCallback(void) {}
-
-
-// interrupt service routines
-ISR(USART0_RX_vect)
-{
-        cli();
-        rxFinishedCallback(UDR0);
-        sei();
-}
+// description, data and interrupt service routines
+USART_DEFINE_INSTANCE(0, E, 1)
 
-ISR(USART0_TX_vect)
-{
-        cli();
-        txFinishedCallback();
-        sei();
-}
+#endif /* USART0_ENABLE */
@@ -1,11 +1,25 @@
 /**
  *******************************************************************************
  * @file        usart0.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Header-file for the internal USART0-periphery.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added usart0_txBuffer and usart0_getTxByteCount. (MS)
+ *                      -# Optional transmission with the Data-Register-
+ *                         Empty-Interrupt (USART0_TX_UDRE). (MS)
+ *                      -# Added usart0_setRts and usart0_checkCts. (MS)
+ *                      -# Generated by USART_DECLARE_INSTANCE of usart.h.
+ *                         (MS)
+ *                      -# Compile-time selection of UBRR and U2X. (MS)
+ *                      -# Added usart0_getIsrCycles. (MS)
+ *                      -# Added usart0_initUbrr. (MS)
+ *                      -# Declared only with USART0_ENABLE, selects the
+ *                         RX-/TX-Callbacks of the interrupt service
+ *                         routines. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -44,53 +58,90 @@
 #ifndef _USART0_H_
 #define _USART0_H_
 
+#include "usart.h"
+#include "usart0_cfg.h"
+
 #include "..\\..\\system.h"
 
+#ifdef USART0_TX_UDRE
+        #define USART0_OPTION_TX_UDRE         USART_OPTION_TX_UDRE
+#else
+        #define USART0_OPTION_TX_UDRE         (0)
+#endif /* USART0_TX_UDRE */
+
+#ifdef USART0_TX_STATISTICS
+        #define USART0_OPTION_TX_STATISTICS   USART_OPTION_TX_STATISTICS
+#else
+        #define USART0_OPTION_TX_STATISTICS   (0)
+#endif /* USART0_TX_STATISTICS */
+
+#ifdef USART0_FLOWCONTROL
+        #define USART0_OPTION_FLOWCONTROL     USART_OPTION_FLOWCONTROL
+#else
+        #define USART0_OPTION_FLOWCONTROL     (0)
+#endif /* USART0_FLOWCONTROL */
+
+#ifdef USART0_ISR_STATISTICS
+        #define USART0_OPTION_ISR_STATISTICS USART_OPTION_ISR_STATISTICS
+#else
+        #define USART0_OPTION_ISR_STATISTICS (0)
+#endif /* USART0_ISR_STATISTICS */
+
+/**
+ *  Options of the USART0-Periphery (see USART_OPTION_*).
+ */
+#define USART0_OPTIONS                 \
+        (USART0_OPTION_TX_UDRE |       \
+         USART0_OPTION_TX_STATISTICS | \
+         USART0_OPTION_FLOWCONTROL |   \
+         USART0_OPTION_ISR_STATISTICS)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- *  Initializes the internal periphery of the USART0.
- *  @param      baudrate: Baudrate.
- *  @return     None.
- *  @pre        None.
- *  @post       USART0 has been initialized.
- */
-void usart0_init(uint32_t baudrate);
+#ifdef USART0_ENABLE
+
+#ifdef USART0_RX_HANDLER
+        void USART0_RX_HANDLER(uint8_t b);
+        #define USART0_RX_CALLBACK          USART0_RX_HANDLER
+#else
+        #define USART0_RX_CALLBACK          usart0_instance.rxFinishedCallback
+#endif /* USART0_RX_HANDLER */
+
+#ifdef USART0_TX_HANDLER
+        void USART0_TX_HANDLER(void);
+        #define USART0_TX_CALLBACK          USART0_TX_HANDLER
+        #define USART0_TX_HANDLER_OR_NULL   USART0_TX_HANDLER
+#else
+        #define USART0_TX_CALLBACK          usart0_instance.txFinishedCallback
+        #define USART0_TX_HANDLER_OR_NULL   NULL
+#endif /* USART0_TX_HANDLER */
 
 /**
- *  Sets the Callback-Function that will be called each time a new Byte has been
- *  received.
- *  @param      callback: Callback-Function of type void:uint8.
- *  @return     None.
- *  @pre        None.
- *  @post       Callback-Function has been set.
+ *  Generates the functions usart0_initUbrr, usart0_setRxFinishedCallback,
+ *  usart0_setTxFinishedCallback, usart0_txByte, usart0_txBuffer,
+ *  usart0_setRts, usart0_checkCts, usart0_getTxByteCount and
+ *  usart0_getIsrCycles. They behave like the functions of the same name in
+ *  usart.h, usart0_initUbrr like usart_init (e.g. with the value of
+ *  usart_calculateUbrr).
  */
-void usart0_setRxFinishedCallback(void (*callback)(uint8_t b));
+USART_DECLARE_INSTANCE(0)
 
 /**
- *  Sets the Callback-Function that will be called each time a Byte has been
- *  transmitted.
- *  @param      callback: Callback-Function of type void:void.
+ *  Initializes the internal periphery of the USART0. The value of the
+ *  UBRR-Register and the double-speed mode are selected at compile-time, the
+ *  build fails if the error of the baudrate exceeds USART0_BAUDRATE_ERROR_MAX.
+ *  @param      baudrate: Baudrate (constant).
  *  @return     None.
  *  @pre        None.
- *  @post       Callback-Function has been set.
+ *  @post       USART0 has been initialized.
  */
-void usart0_setTxFinishedCallback(void (*callback)(void));
+#define usart0_init(_baudrate_)      \
+        usart_init(&usart0_instance, \
+                   USART_UBRR(_baudrate_, USART0_BAUDRATE_ERROR_MAX))
 
-/**
- *  Starts the transmission of a single Byte.                                 @n
- *  After the transmission the set Callback-Function (TX) will be called.
- *  @param      b: Byte to transmit.
- *  @return     None.
- *  @pre        The function usart1_init had been called.
- *  @post       The transmission of the Byte has started.
- */
-inline void usart0_txByte(uint8_t b)
-{
-        UDR0 = b;
-}
+#endif /* USART0_ENABLE */
 
 #ifdef __cplusplus
 } // extern "C"
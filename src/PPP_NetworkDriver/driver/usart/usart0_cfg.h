@@ -1,11 +1,20 @@
 /**
  *******************************************************************************
  * @file        usart0_cfg.h
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Config-file for the internal USART0-periphery.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added USART0_TX_UDRE and USART0_TX_STATISTICS. (MS)
+ *                      -# Added USART0_FLOWCONTROL. (MS)
+ *                      -# Replaced USART0_USE2X by USART0_BAUDRATE_ERROR_MAX.
+ *                         (MS)
+ *                      -# Added USART0_ISR_STATISTICS and the direct
+ *                         RX-/TX-Handlers. (MS)
+ *                      -# Added USART0_ENABLE. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Modification of databit-calculation. (MS)
  *
@@ -47,6 +56,13 @@
 #ifndef _USART0_CFG_H_
 #define _USART0_CFG_H_
 
+/**
+ *  Comment this Define to compile the driver of the USART0-periphery.
+ *  Otherwise it has no code, data or interrupt service routines.
+ *  The serial console uses this USART-periphery.
+ */
+#define USART0_ENABLE
+
 /**
  *  This Define will specify the width of the data in Bits.                   @n
  *  Possible values are:                                                      @n
@@ -76,8 +92,62 @@
 #define USART0_STOPBITS (0)
 
 /**
- *  Uncommented this Define to enable double-speed for the USART0-Periphery.
+ *  Maximum error of the baudrate in 1/1000. The double-speed mode is
+ *  selected automatically if it gives the lower error.                       @n
+ *  At 16 MHz 115200 Baud has an error of 21/1000 (2.1 %).
+ */
+#define USART0_BAUDRATE_ERROR_MAX (25)
+
+/**
+ *  Uncomment this Define to transmit with the Data-Register-Empty-Interrupt.
+ *  The next Byte is written while the previous Byte is still shifted out, so
+ *  the line does not idle between two Bytes. Otherwise the Transmit-Complete-
+ *  Interrupt is used.
+ */
+#define USART0_TX_UDRE
+
+/**
+ *  Uncomment this Define to count the transmitted Bytes (see
+ *  usart0_getTxByteCount).
+ */
+//#define USART0_TX_STATISTICS
+
+/**
+ *  Uncomment this Define to enable the hardware flow-control (RTS/CTS).      @n
+ *  RTS is an output and LOW while usart0_setRts allows the remote side to
+ *  transmit. CTS is an input with pull-up, the transmission pauses while it
+ *  is HIGH. An unconnected CTS-Pin therefore stops the transmission.
+ */
+//#define USART0_FLOWCONTROL
+
+/**
+ *  Uncomment this Define to measure the maximum run-time of the interrupt
+ *  service routines in CPU-cycles (see usart0_getIsrCycles). It uses the
+ *  Timer of cycleCounter_cfg.h.
+ */
+//#define USART0_ISR_STATISTICS
+
+/**
+ *  Handlers that are called directly by the interrupt service routines
+ *  instead of the Callback-Functions, which are ignored while the handler is
+ *  defined. Without the indirect call the compiler saves only the registers
+ *  that are used and can inline the handler (LTO).                           @n
+ *  RX-Handler: void handler(uint8_t b)                                       @n
+ *  TX-Handler: void handler(void)
+ */
+//#define USART0_RX_HANDLER rxHandler
+//#define USART0_TX_HANDLER txHandler
+
+/**
+ *  Port and Pin of the RTS-Output (Arduino Mega: Pin 24).
+ */
+#define USART0_RTS_PORT A
+#define USART0_RTS_PIN  (2)
+
+/**
+ *  Port and Pin of the CTS-Input (Arduino Mega: Pin 25).
  */
-#define USART0_USE2X
+#define USART0_CTS_PORT A
+#define USART0_CTS_PIN  (3)
 
 #endif /* _USART0_CFG_H_ */
\ No newline at end of file
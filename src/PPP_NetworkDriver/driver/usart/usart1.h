@@ -1,11 +1,25 @@
 /**
  *******************************************************************************
  * @file        usart1.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Header-file for the internal USART1-periphery.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added usart1_txBuffer and usart1_getTxByteCount. (MS)
+ *                      -# Optional transmission with the Data-Register-
+ *                         Empty-Interrupt (USART1_TX_UDRE). (MS)
+ *                      -# Added usart1_setRts and usart1_checkCts. (MS)
+ *                      -# Generated by USART_DECLARE_INSTANCE of usart.h.
+ *                         (MS)
+ *                      -# Compile-time selection of UBRR and U2X. (MS)
+ *                      -# Added usart1_getIsrCycles. (MS)
+ *                      -# Added usart1_initUbrr. (MS)
+ *                      -# Declared only with USART1_ENABLE, selects the
+ *                         RX-/TX-Callbacks of the interrupt service
+ *                         routines. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -44,53 +58,90 @@
 #ifndef _USART1_H_
 #define _USART1_H_
 
+#include "usart.h"
+#include "usart1_cfg.h"
+
 #include "..\\..\\system.h"
 
+#ifdef USART1_TX_UDRE
+        #define USART1_OPTION_TX_UDRE         USART_OPTION_TX_UDRE
+#else
+        #define USART1_OPTION_TX_UDRE         (0)
+#endif /* USART1_TX_UDRE */
+
+#ifdef USART1_TX_STATISTICS
+        #define USART1_OPTION_TX_STATISTICS   USART_OPTION_TX_STATISTICS
+#else
+        #define USART1_OPTION_TX_STATISTICS   (0)
+#endif /* USART1_TX_STATISTICS */
+
+#ifdef USART1_FLOWCONTROL
+        #define USART1_OPTION_FLOWCONTROL     USART_OPTION_FLOWCONTROL
+#else
+        #define USART1_OPTION_FLOWCONTROL     (0)
+#endif /* USART1_FLOWCONTROL */
+
+#ifdef USART1_ISR_STATISTICS
+        #define USART1_OPTION_ISR_STATISTICS USART_OPTION_ISR_STATISTICS
+#else
+        #define USART1_OPTION_ISR_STATISTICS (0)
+#endif /* USART1_ISR_STATISTICS */
+
+/**
+ *  Options of the USART1-Periphery (see USART_OPTION_*).
+ */
+#define USART1_OPTIONS                 \
+        (USART1_OPTION_TX_UDRE |       \
+         USART1_OPTION_TX_STATISTICS | \
+         USART1_OPTION_FLOWCONTROL |   \
+         USART1_OPTION_ISR_STATISTICS)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/**
- *  Initializes the internal periphery of the USART1.
- *  @param      baudrate: Baudrate.
- *  @return     None.
- *  @pre        None.
- *  @post       USART1 has been initialized.
- */
-void usart1_init(uint32_t baudrate);
+#ifdef USART1_ENABLE
+
+#ifdef USART1_RX_HANDLER
+        void USART1_RX_HANDLER(uint8_t b);
+        #define USART1_RX_CALLBACK          USART1_RX_HANDLER
+#else
+        #define USART1_RX_CALLBACK          usart1_instance.rxFinishedCallback
+#endif /* USART1_RX_HANDLER */
+
+#ifdef USART1_TX_HANDLER
+        void USART1_TX_HANDLER(void);
+        #define USART1_TX_CALLBACK          USART1_TX_HANDLER
+        #define USART1_TX_HANDLER_OR_NULL   USART1_TX_HANDLER
+#else
+        #define USART1_TX_CALLBACK          usart1_instance.txFinishedCallback
+        #define USART1_TX_HANDLER_OR_NULL   NULL
+#endif /* USART1_TX_HANDLER */
 
 /**
- *  Sets the Callback-Function that will be called each time a new Byte has been
- *  received.
- *  @param      callback: Callback-Function of type void:uint8.
- *  @return     None.
- *  @pre        None.
- *  @post       Callback-Function has been set.
+ *  Generates the functions usart1_initUbrr, usart1_setRxFinishedCallback,
+ *  usart1_setTxFinishedCallback, usart1_txByte, usart1_txBuffer,
+ *  usart1_setRts, usart1_checkCts, usart1_getTxByteCount and
+ *  usart1_getIsrCycles. They behave like the functions of the same name in
+ *  usart.h, usart1_initUbrr like usart_init (e.g. with the value of
+ *  usart_calculateUbrr).
  */
-void usart1_setRxFinishedCallback(void (*callback)(uint8_t b));
+USART_DECLARE_INSTANCE(1)
 
 /**
- *  Sets the Callback-Function that will be called each time a Byte has been
- *  transmitted.
- *  @param      callback: Callback-Function of type void:void.
+ *  Initializes the internal periphery of the USART1. The value of the
+ *  UBRR-Register and the double-speed mode are selected at compile-time, the
+ *  build fails if the error of the baudrate exceeds USART1_BAUDRATE_ERROR_MAX.
+ *  @param      baudrate: Baudrate (constant).
  *  @return     None.
  *  @pre        None.
- *  @post       Callback-Function has been set.
+ *  @post       USART1 has been initialized.
  */
-void usart1_setTxFinishedCallback(void (*callback)(void));
+#define usart1_init(_baudrate_)      \
+        usart_init(&usart1_instance, \
+                   USART_UBRR(_baudrate_, USART1_BAUDRATE_ERROR_MAX))
 
-/**
- *  Starts the transmission of a single Byte.                                 @n
- *  After the transmission the set Callback-Function (TX) will be called.
- *  @param      b: Byte to transmit.
- *  @return     None.
- *  @pre        The function usart1_init had been called.
- *  @post       The transmission of the Byte has started.
- */
-inline void usart1_txByte(uint8_t b)
-{
-        UDR1 = b;
-}
+#endif /* USART1_ENABLE */
 
 #ifdef __cplusplus
 } // extern "C"
@@ -0,0 +1,55 @@
+/**
+ *******************************************************************************
+ * @file        usart2.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file for the internal USART2-periphery.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "usart2.h"
+#include "usart2_cfg.h"
+
+#include "..\\..\\system.h"
+
+#ifdef USART2_ENABLE
+
+#ifndef __AVR_ATmega2560__
+        #error "undefined processor"
+#endif
+
+// description, data and interrupt service routines
+USART_DEFINE_INSTANCE(2, H, 1)
+
+#endif /* USART2_ENABLE */
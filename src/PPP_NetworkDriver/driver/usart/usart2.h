@@ -0,0 +1,133 @@
+/**
+ *******************************************************************************
+ * @file        usart2.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file for the internal USART2-periphery.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _USART2_H_
+#define _USART2_H_
+
+#include "usart.h"
+#include "usart2_cfg.h"
+
+#include "..\\..\\system.h"
+
+#ifdef USART2_TX_UDRE
+        #define USART2_OPTION_TX_UDRE         USART_OPTION_TX_UDRE
+#else
+        #define USART2_OPTION_TX_UDRE         (0)
+#endif /* USART2_TX_UDRE */
+
+#ifdef USART2_TX_STATISTICS
+        #define USART2_OPTION_TX_STATISTICS   USART_OPTION_TX_STATISTICS
+#else
+        #define USART2_OPTION_TX_STATISTICS   (0)
+#endif /* USART2_TX_STATISTICS */
+
+#ifdef USART2_FLOWCONTROL
+        #define USART2_OPTION_FLOWCONTROL     USART_OPTION_FLOWCONTROL
+#else
+        #define USART2_OPTION_FLOWCONTROL     (0)
+#endif /* USART2_FLOWCONTROL */
+
+#ifdef USART2_ISR_STATISTICS
+        #define USART2_OPTION_ISR_STATISTICS USART_OPTION_ISR_STATISTICS
+#else
+        #define USART2_OPTION_ISR_STATISTICS (0)
+#endif /* USART2_ISR_STATISTICS */
+
+/**
+ *  Options of the USART2-Periphery (see USART_OPTION_*).
+ */
+#define USART2_OPTIONS                 \
+        (USART2_OPTION_TX_UDRE |       \
+         USART2_OPTION_TX_STATISTICS | \
+         USART2_OPTION_FLOWCONTROL |   \
+         USART2_OPTION_ISR_STATISTICS)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef USART2_ENABLE
+
+#ifdef USART2_RX_HANDLER
+        void USART2_RX_HANDLER(uint8_t b);
+        #define USART2_RX_CALLBACK          USART2_RX_HANDLER
+#else
+        #define USART2_RX_CALLBACK          usart2_instance.rxFinishedCallback
+#endif /* USART2_RX_HANDLER */
+
+#ifdef USART2_TX_HANDLER
+        void USART2_TX_HANDLER(void);
+        #define USART2_TX_CALLBACK          USART2_TX_HANDLER
+        #define USART2_TX_HANDLER_OR_NULL   USART2_TX_HANDLER
+#else
+        #define USART2_TX_CALLBACK          usart2_instance.txFinishedCallback
+        #define USART2_TX_HANDLER_OR_NULL   NULL
+#endif /* USART2_TX_HANDLER */
+
+/**
+ *  Generates the functions usart2_initUbrr, usart2_setRxFinishedCallback,
+ *  usart2_setTxFinishedCallback, usart2_txByte, usart2_txBuffer,
+ *  usart2_setRts, usart2_checkCts, usart2_getTxByteCount and
+ *  usart2_getIsrCycles. They behave like the functions of the same name in
+ *  usart.h, usart2_initUbrr like usart_init (e.g. with the value of
+ *  usart_calculateUbrr).
+ */
+USART_DECLARE_INSTANCE(2)
+
+/**
+ *  Initializes the internal periphery of the USART2. The value of the
+ *  UBRR-Register and the double-speed mode are selected at compile-time, the
+ *  build fails if the error of the baudrate exceeds USART2_BAUDRATE_ERROR_MAX.
+ *  @param      baudrate: Baudrate (constant).
+ *  @return     None.
+ *  @pre        None.
+ *  @post       USART2 has been initialized.
+ */
+#define usart2_init(_baudrate_)      \
+        usart_init(&usart2_instance, \
+                   USART_UBRR(_baudrate_, USART2_BAUDRATE_ERROR_MAX))
+
+#endif /* USART2_ENABLE */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _USART2_H_ */
@@ -0,0 +1,133 @@
+/**
+ *******************************************************************************
+ * @file        usart3.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file for the internal USART3-periphery.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _USART3_H_
+#define _USART3_H_
+
+#include "usart.h"
+#include "usart3_cfg.h"
+
+#include "..\\..\\system.h"
+
+#ifdef USART3_TX_UDRE
+        #define USART3_OPTION_TX_UDRE         USART_OPTION_TX_UDRE
+#else
+        #define USART3_OPTION_TX_UDRE         (0)
+#endif /* USART3_TX_UDRE */
+
+#ifdef USART3_TX_STATISTICS
+        #define USART3_OPTION_TX_STATISTICS   USART_OPTION_TX_STATISTICS
+#else
+        #define USART3_OPTION_TX_STATISTICS   (0)
+#endif /* USART3_TX_STATISTICS */
+
+#ifdef USART3_FLOWCONTROL
+        #define USART3_OPTION_FLOWCONTROL     USART_OPTION_FLOWCONTROL
+#else
+        #define USART3_OPTION_FLOWCONTROL     (0)
+#endif /* USART3_FLOWCONTROL */
+
+#ifdef USART3_ISR_STATISTICS
+        #define USART3_OPTION_ISR_STATISTICS USART_OPTION_ISR_STATISTICS
+#else
+        #define USART3_OPTION_ISR_STATISTICS (0)
+#endif /* USART3_ISR_STATISTICS */
+
+/**
+ *  Options of the USART3-Periphery (see USART_OPTION_*).
+ */
+#define USART3_OPTIONS                 \
+        (USART3_OPTION_TX_UDRE |       \
+         USART3_OPTION_TX_STATISTICS | \
+         USART3_OPTION_FLOWCONTROL |   \
+         USART3_OPTION_ISR_STATISTICS)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef USART3_ENABLE
+
+#ifdef USART3_RX_HANDLER
+        void USART3_RX_HANDLER(uint8_t b);
+        #define USART3_RX_CALLBACK          USART3_RX_HANDLER
+#else
+        #define USART3_RX_CALLBACK          usart3_instance.rxFinishedCallback
+#endif /* USART3_RX_HANDLER */
+
+#ifdef USART3_TX_HANDLER
+        void USART3_TX_HANDLER(void);
+        #define USART3_TX_CALLBACK          USART3_TX_HANDLER
+        #define USART3_TX_HANDLER_OR_NULL   USART3_TX_HANDLER
+#else
+        #define USART3_TX_CALLBACK          usart3_instance.txFinishedCallback
+        #define USART3_TX_HANDLER_OR_NULL   NULL
+#endif /* USART3_TX_HANDLER */
+
+/**
+ *  Generates the functions usart3_initUbrr, usart3_setRxFinishedCallback,
+ *  usart3_setTxFinishedCallback, usart3_txByte, usart3_txBuffer,
+ *  usart3_setRts, usart3_checkCts, usart3_getTxByteCount and
+ *  usart3_getIsrCycles. They behave like the functions of the same name in
+ *  usart.h, usart3_initUbrr like usart_init (e.g. with the value of
+ *  usart_calculateUbrr).
+ */
+USART_DECLARE_INSTANCE(3)
+
+/**
+ *  Initializes the internal periphery of the USART3. The value of the
+ *  UBRR-Register and the double-speed mode are selected at compile-time, the
+ *  build fails if the error of the baudrate exceeds USART3_BAUDRATE_ERROR_MAX.
+ *  @param      baudrate: Baudrate (constant).
+ *  @return     None.
+ *  @pre        None.
+ *  @post       USART3 has been initialized.
+ */
+#define usart3_init(_baudrate_)      \
+        usart_init(&usart3_instance, \
+                   USART_UBRR(_baudrate_, USART3_BAUDRATE_ERROR_MAX))
+
+#endif /* USART3_ENABLE */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _USART3_H_ */
@@ -0,0 +1,137 @@
+/**
+ *******************************************************************************
+ * @file        usart3_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file for the internal USART3-periphery.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _USART3_CFG_H_
+#define _USART3_CFG_H_
+
+/**
+ *  Uncomment this Define to compile the driver of the USART3-periphery.
+ *  Otherwise it has no code, data or interrupt service routines.
+ */
+//#define USART3_ENABLE
+
+/**
+ *  This Define will specify the width of the data in Bits.                   @n
+ *  Possible values are:                                                      @n
+ *  5 -> 5 Databits                                                           @n
+ *  6 -> 6 Databits                                                           @n
+ *  7 -> 7 Databits                                                           @n
+ *  8 -> 8 Databits                                                           @n
+ *  9 -> 9 Databits
+ */
+#define USART3_DATABITS (8)
+
+/**
+ *  This Define will specify the Parity-Mode.                                 @n
+ *  Possible values are:                                                      @n
+ *  0 -> No Parity.                                                           @n
+ *  2 -> Even Parity.                                                         @n
+ *  3 -> Odd Parity.
+ */
+#define USART3_PARITY (0)
+
+/**
+ *  This Define will specify the number of Stop-Bits.                         @n
+ *  Possible values are:                                                      @n
+ *  0 -> 1 Stop-Bit.                                                          @n
+ *  1 -> 2 Stop-Bits.
+ */
+#define USART3_STOPBITS (0)
+
+/**
+ *  Maximum error of the baudrate in 1/1000. The double-speed mode is
+ *  selected automatically if it gives the lower error.                       @n
+ *  At 16 MHz 115200 Baud has an error of 21/1000 (2.1 %).
+ */
+#define USART3_BAUDRATE_ERROR_MAX (25)
+
+/**
+ *  Uncomment this Define to transmit with the Data-Register-Empty-Interrupt.
+ *  The next Byte is written while the previous Byte is still shifted out, so
+ *  the line does not idle between two Bytes. Otherwise the Transmit-Complete-
+ *  Interrupt is used.
+ */
+#define USART3_TX_UDRE
+
+/**
+ *  Uncomment this Define to count the transmitted Bytes (see
+ *  usart3_getTxByteCount).
+ */
+//#define USART3_TX_STATISTICS
+
+/**
+ *  Uncomment this Define to enable the hardware flow-control (RTS/CTS).      @n
+ *  RTS is an output and LOW while usart3_setRts allows the remote side to
+ *  transmit. CTS is an input with pull-up, the transmission pauses while it
+ *  is HIGH. An unconnected CTS-Pin therefore stops the transmission.
+ */
+//#define USART3_FLOWCONTROL
+
+/**
+ *  Uncomment this Define to measure the maximum run-time of the interrupt
+ *  service routines in CPU-cycles (see usart3_getIsrCycles). It uses the
+ *  Timer of cycleCounter_cfg.h.
+ */
+//#define USART3_ISR_STATISTICS
+
+/**
+ *  Handlers that are called directly by the interrupt service routines
+ *  instead of the Callback-Functions, which are ignored while the handler is
+ *  defined. Without the indirect call the compiler saves only the registers
+ *  that are used and can inline the handler (LTO).                           @n
+ *  RX-Handler: void handler(uint8_t b)                                       @n
+ *  TX-Handler: void handler(void)
+ */
+//#define USART3_RX_HANDLER rxHandler
+//#define USART3_TX_HANDLER txHandler
+
+/**
+ *  Port and Pin of the RTS-Output (Arduino Mega: Pin 28).
+ */
+#define USART3_RTS_PORT A
+#define USART3_RTS_PIN  (6)
+
+/**
+ *  Port and Pin of the CTS-Input (Arduino Mega: Pin 29).
+ */
+#define USART3_CTS_PORT A
+#define USART3_CTS_PIN  (7)
+
+#endif /* _USART3_CFG_H_ */
\ No newline at end of file
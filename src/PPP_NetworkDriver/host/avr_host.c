@@ -0,0 +1,278 @@
+/**
+ *******************************************************************************
+ * @file        avr_host.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the host-platform: registers, emulated
+ *              interrupts and Timers, delays and the avr-libc extensions of
+ *              stdlib.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#define HOST_DEFINE_REGISTERS
+#include <avr/io.h>
+
+#include "avr_host.h"
+
+#include "..\\config.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+// type-definitions
+/**
+ *  Emulated 16-Bit-Timer in normal mode. The counter is calculated from the
+ *  time since the prescaler had been set.
+ */
+struct timer_t {
+        volatile uint8_t                *tccrb;
+        volatile uint16_t               *tcnt;
+        volatile uint8_t                *timsk;
+        volatile uint8_t                *tifr;
+        void                            (*overflowVector)(void);
+        uint16_t                        prescaler;
+        uint64_t                        start;
+        uint16_t                        startCount;
+        uint64_t                        overflows;
+};
+
+/**
+ *  The overflow interrupt service routines are weak, a Timer without one
+ *  only sets its overflow flag.
+ */
+#define TIMER_VECTOR(_n_) \
+        void TIMER##_n_##_OVF_vect(void) __attribute__((weak))
+TIMER_VECTOR(1);
+TIMER_VECTOR(3);
+TIMER_VECTOR(4);
+TIMER_VECTOR(5);
+
+#define TIMER_INITIALIZER(_n_)                                  \
+        {                                                       \
+                .tccrb = &TCCR##_n_##B,                         \
+                .tcnt = &TCNT##_n_,                             \
+                .timsk = &TIMSK##_n_,                           \
+                .tifr = &TIFR##_n_,                             \
+                .overflowVector = TIMER##_n_##_OVF_vect,        \
+        }
+
+// private function prototypes
+static void setInterruptSignalMask(int how);
+static void serveTimer(struct timer_t *timer, uint64_t now);
+static char *unsignedToString(unsigned long value, char *s, int radix,
+                              bool isNegative);
+
+// private data
+static struct timer_t timers[] = {
+        TIMER_INITIALIZER(1),
+        TIMER_INITIALIZER(3),
+        TIMER_INITIALIZER(4),
+        TIMER_INITIALIZER(5),
+};
+
+// public functions
+void host_cli(void)
+{
+        setInterruptSignalMask(SIG_BLOCK);
+}
+
+void host_sei(void)
+{
+        setInterruptSignalMask(SIG_UNBLOCK);
+}
+
+uint8_t host_getInterruptState(void)
+{
+        sigset_t mask;
+
+        sigprocmask(SIG_BLOCK, NULL, &mask);
+        return sigismember(&mask, HOST_INTERRUPT_SIGNAL) ? 0 : 1;
+}
+
+void host_atomicRestoreState(const uint8_t *state)
+{
+        if (*state)
+                host_sei();
+}
+
+void host_atomicForceOn(const uint8_t *state)
+{
+        (void)state;
+        host_sei();
+}
+
+void host_sleepCpu(void)
+{
+        sigset_t mask;
+
+        // the signal is unblocked and waited for in one step
+        sigprocmask(SIG_BLOCK, NULL, &mask);
+        sigdelset(&mask, HOST_INTERRUPT_SIGNAL);
+        sigsuspend(&mask);
+}
+
+void host_delayUs(uint32_t us)
+{
+        struct timespec deadline;
+
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += us / 1000000UL;
+        deadline.tv_nsec += (long)(us % 1000000UL) * 1000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+        }
+
+        // the sleep is interrupted by every emulated interrupt
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+                               &deadline, NULL) == EINTR)
+                ;
+}
+
+void host_serveTimers(void)
+{
+        struct timespec now;
+        uint8_t i;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        for (i = 0; i < sizeof(timers) / sizeof(timers[0]); i++)
+                serveTimer(&timers[i],
+                           (uint64_t)now.tv_sec * 1000000000ULL +
+                           (uint64_t)now.tv_nsec);
+}
+
+char *itoa(int value, char *s, int radix)
+{
+        if ((value < 0) && (radix == 10))
+                return unsignedToString(-(unsigned long)value, s, radix, true);
+        return unsignedToString((unsigned int)value, s, radix, false);
+}
+
+char *utoa(unsigned int value, char *s, int radix)
+{
+        return unsignedToString(value, s, radix, false);
+}
+
+char *ltoa(long value, char *s, int radix)
+{
+        if ((value < 0) && (radix == 10))
+                return unsignedToString(-(unsigned long)value, s, radix, true);
+        return unsignedToString((unsigned long)value, s, radix, false);
+}
+
+char *ultoa(unsigned long value, char *s, int radix)
+{
+        return unsignedToString(value, s, radix, false);
+}
+
+// private functions
+static void setInterruptSignalMask(int how)
+{
+        sigset_t mask;
+
+        sigemptyset(&mask);
+        sigaddset(&mask, HOST_INTERRUPT_SIGNAL);
+        sigprocmask(how, &mask, NULL);
+}
+
+static void serveTimer(struct timer_t *timer, uint64_t now)
+{
+        // clock-select of TCCRnB: stopped, 1, 8, 64, 256, 1024, external
+        static const uint16_t prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+        uint16_t prescaler = prescalers[*timer->tccrb & 0x07];
+        uint64_t count;
+
+        // TOIEn and TOVn are Bit 0 of all 16-Bit-Timers. Writing 1 to clear
+        // the flag can not be emulated, it is cleared when the Timer starts
+        // and when the interrupt service routine is called instead.
+        if (prescaler != timer->prescaler) {
+                // the Timer continues from its current value
+                timer->prescaler = prescaler;
+                timer->start = now;
+                timer->startCount = *timer->tcnt;
+                timer->overflows = 0;
+                *timer->tifr &= ~(1 << TOV1);
+        }
+        if (prescaler == 0)
+                return;
+
+        count = timer->startCount +
+                (now - timer->start) * (F_CPU / 1000000UL) /
+                (1000ULL * prescaler);
+        *timer->tcnt = (uint16_t)count;
+
+        while (timer->overflows < (count >> 16)) {
+                timer->overflows++;
+                if ((*timer->timsk & (1 << TOIE1)) &&
+                    (timer->overflowVector != NULL)) {
+                        *timer->tifr &= ~(1 << TOV1);
+                        timer->overflowVector();
+                } else {
+                        *timer->tifr |= (1 << TOV1);
+                }
+        }
+}
+
+static char *unsignedToString(unsigned long value, char *s, int radix,
+                              bool isNegative)
+{
+        char digits[sizeof(unsigned long) * 8];
+        uint8_t count = 0;
+        char *p = s;
+
+        if ((radix < 2) || (radix > 36)) {
+                *s = '\0';
+                return s;
+        }
+
+        do {
+                uint8_t digit = value % radix;
+
+                digits[count++] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+                value /= radix;
+        } while (value != 0);
+
+        if (isNegative)
+                *p++ = '-';
+        while (count > 0)
+                *p++ = digits[--count];
+        *p = '\0';
+
+        return s;
+}
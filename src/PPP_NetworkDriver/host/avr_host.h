@@ -0,0 +1,150 @@
+/**
+ *******************************************************************************
+ * @file        avr_host.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the host-platform, which replaces the parts of
+ *              avr-libc that are used by the drivers so they can be compiled
+ *              and run on Linux.
+ *              The interrupts are emulated by a signal (HOST_INTERRUPT_SIGNAL)
+ *              of the main thread: the handler interrupts the main program at
+ *              any instruction like an interrupt of the Microprocessor and
+ *              blocking the signal disables the interrupts.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _AVR_HOST_H_
+#define _AVR_HOST_H_
+
+#include <stdint.h>
+#include <signal.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Signal that emulates the interrupts. The handler is installed by
+ *  usart_host.c.
+ */
+#define HOST_INTERRUPT_SIGNAL SIGALRM
+
+/**
+ *  Disables the interrupts (cli).
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The handler of HOST_INTERRUPT_SIGNAL is not called.
+ */
+void host_cli(void);
+
+/**
+ *  Enables the interrupts (sei).
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The handler of HOST_INTERRUPT_SIGNAL can be called.
+ */
+void host_sei(void);
+
+/**
+ *  Checks if the interrupts are enabled (I-Bit of SREG).
+ *  @return     1 if the interrupts are enabled, 0 otherwise.
+ *  @pre        None.
+ *  @post       None.
+ */
+uint8_t host_getInterruptState(void);
+
+/**
+ *  Disables the interrupts at the beginning of an ATOMIC_BLOCK. It is inline,
+ *  so the compiler knows that the block is executed once.
+ *  @return     Always 1.
+ *  @pre        None.
+ *  @post       The interrupts are disabled.
+ */
+static inline uint8_t host_atomicBegin(void)
+{
+        host_cli();
+        return 1;
+}
+
+/**
+ *  Restores the interrupts at the end of an ATOMIC_BLOCK(ATOMIC_RESTORESTATE).
+ *  @param      state: Pointer to the result of host_getInterruptState.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The interrupts are enabled if they had been enabled before.
+ */
+void host_atomicRestoreState(const uint8_t *state);
+
+/**
+ *  Enables the interrupts at the end of an ATOMIC_BLOCK(ATOMIC_FORCEON).
+ *  @param      state: Unused.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The interrupts are enabled.
+ */
+void host_atomicForceOn(const uint8_t *state);
+
+/**
+ *  Updates the counters of the emulated 16-Bit-Timers and calls their
+ *  overflow interrupt service routines. Only the normal mode is emulated.
+ *  @return     None.
+ *  @pre        Called by the handler of HOST_INTERRUPT_SIGNAL.
+ *  @post       None.
+ */
+void host_serveTimers(void);
+
+/**
+ *  Waits for the next emulated interrupt (sleep_cpu). The tick of the
+ *  emulated periphery (USART_HOST_TICK_US) wakes it up, an interrupt that has
+ *  been served by sei just before is not waited for.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The interrupts are enabled.
+ */
+void host_sleepCpu(void);
+
+/**
+ *  Waits for a specific time, the interrupts are still served.
+ *  @param      us: Time in microseconds.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       None.
+ */
+void host_delayUs(uint32_t us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AVR_HOST_H_ */
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+################################################################################
+# @file        capture_pcap.py
+# @version     0.0.1
+# @date        2026.10.19
+# @author      Michael Strosche (TheCross)
+# @brief       Converter of the frame-capture (utils/capture.h). It reads the
+#              output of the serial console from a file, a serial device or
+#              stdin and writes every record into a pcap-file for Wireshark.
+#              The other output is printed to stderr, the events of the
+#              event-log are skipped. The file is flushed after every
+#              record, so it can be read while the capture is running.
+#                      build/ppp_host -0 fd:3 3>&1 >/dev/null | \
+#                              ./capture_pcap.py -o ppp.pcap
+#                      ./capture_pcap.py /dev/ttyACM0 -b 115200 -o - | \
+#                              wireshark -k -i -
+#
+# @since       V0.0.1, 2026.10.19:
+#                      -# Initial version. (MS)
+################################################################################
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+MARKER = 0x1D
+EVENTLOG_MARKER = 0x1E
+HEADER_LENGTH = 9
+FLAG_TX = 0x01
+
+LINKTYPE_PPP_SERIAL = 50
+LINKTYPE_PPP_WITH_DIR = 204
+
+
+class PcapWriter:
+    """Writes the records into a pcap-file."""
+
+    def __init__(self, output, direction):
+        self.output = output
+        self.direction = direction
+        self.start = time.time()
+        self.first = None
+        self.last = 0
+        self.wraps = 0
+        linktype = LINKTYPE_PPP_WITH_DIR if direction else LINKTYPE_PPP_SERIAL
+        self.output.write(struct.pack('<IHHiIII', 0xA1B2C3D4, 2, 4, 0, 0,
+                                      65535, linktype))
+        self.output.flush()
+
+    def timestamp(self, micros):
+        """Converts the 32-Bit clock of the device into seconds since the
+        epoch, the first record gets the time of the start."""
+        if self.first is None:
+            self.first = micros
+        elif micros < self.last:
+            self.wraps += 1
+        self.last = micros
+        elapsed = (micros - self.first) + (self.wraps << 32)
+        return self.start + elapsed / 1000000
+
+    def write(self, flags, micros, original_length, frame):
+        seconds = self.timestamp(micros)
+        if self.direction:
+            # 0x00: received, 0x01: sent by the device
+            frame = bytes([flags & FLAG_TX]) + frame
+            original_length += 1
+        self.output.write(struct.pack('<IIII',
+                                      int(seconds),
+                                      int(seconds * 1000000) % 1000000,
+                                      len(frame),
+                                      original_length))
+        self.output.write(frame)
+        self.output.flush()
+
+
+def convert(stream, writer, text):
+    """Converts the stream until its end, returns the number of records."""
+    state = 'text'
+    length = 0
+    data = bytearray()
+    records = 0
+
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        b = chunk[0]
+
+        if state == 'text':
+            if b == MARKER:
+                data = bytearray()
+                state = 'record'
+            elif b == EVENTLOG_MARKER:
+                state = 'id'
+            else:
+                text.write(chr(b) if 0x20 <= b < 0x7F or b in (0x09, 0x0A, 0x0D)
+                           else '\\x%02x' % b)
+                text.flush()
+        elif state == 'record':
+            # flags, timestamp, original and captured length, frame
+            data.append(b)
+            if len(data) >= HEADER_LENGTH:
+                flags, micros, original_length, length = \
+                    struct.unpack_from('<BIHH', data)
+                if len(data) == HEADER_LENGTH + length:
+                    writer.write(flags, micros, original_length,
+                                 bytes(data[HEADER_LENGTH:]))
+                    records += 1
+                    state = 'text'
+        elif state == 'id':
+            state = 'length'
+        elif state == 'length':
+            length = b
+            state = 'args' if length > 0 else 'text'
+        else:
+            length -= 1
+            if length == 0:
+                state = 'text'
+
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Writes the frame-capture '
+                                     'into a pcap-file.')
+    parser.add_argument('input', nargs='?', help='file or serial device '
+                        '(default: stdin)')
+    parser.add_argument('-b', '--baudrate', type=int, default=115200,
+                        help='baudrate of a serial device')
+    parser.add_argument('-o', '--output', default='capture.pcap',
+                        help='pcap-file, - for stdout (default: capture.pcap)')
+    parser.add_argument('-d', '--direction', action='store_true',
+                        help='write the direction of the frames '
+                        '(LINKTYPE_PPP_WITH_DIR)')
+    arguments = parser.parse_args()
+
+    if arguments.input is None:
+        stream = sys.stdin.buffer
+    elif arguments.input.startswith('/dev/tty'):
+        import termios
+        fd = os.open(arguments.input, os.O_RDONLY | os.O_NOCTTY)
+        attributes = termios.tcgetattr(fd)
+        speed = getattr(termios, 'B%d' % arguments.baudrate)
+        attributes[0] = 0                               # iflag
+        attributes[1] = 0                               # oflag
+        attributes[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attributes[3] = 0                               # lflag
+        attributes[4] = speed
+        attributes[5] = speed
+        termios.tcsetattr(fd, termios.TCSANOW, attributes)
+        stream = os.fdopen(fd, 'rb', buffering=0)
+    else:
+        stream = open(arguments.input, 'rb')
+
+    if arguments.output == '-':
+        output = sys.stdout.buffer
+    else:
+        output = open(arguments.output, 'wb')
+
+    records = 0
+    try:
+        records = convert(stream, PcapWriter(output, arguments.direction),
+                          sys.stderr)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        output.close()
+    sys.stderr.write('%d frames\n' % records)
+
+
+if __name__ == '__main__':
+    main()
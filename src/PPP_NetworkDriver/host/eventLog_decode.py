@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+################################################################################
+# @file        eventLog_decode.py
+# @version     0.0.1
+# @date        2026.10.19
+# @author      Michael Strosche (TheCross)
+# @brief       Decoder of the event-log (utils/eventLog.h). It reads the output
+#              of the serial console from a file, a serial device or stdin,
+#              prints the other output unchanged and every event as a line
+#              of text. The formats are read from utils/eventLog_events.h,
+#              so the decoder must use the list of the firmware. The
+#              records of the frame-capture (see capture_pcap.py) are
+#              skipped.
+#                      build/ppp_host | ./eventLog_decode.py
+#                      ./eventLog_decode.py /dev/ttyACM0 -b 115200
+#
+# @since       V0.0.1, 2026.10.19:
+#                      -# Initial version. (MS)
+################################################################################
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MARKER = 0x1E
+CAPTURE_MARKER = 0x1D
+CAPTURE_HEADER_LENGTH = 9
+EVENTS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      '..', 'utils', 'eventLog_events.h')
+
+
+def read_events(path):
+    """Returns the formats of the events, the index is the ID."""
+    pattern = re.compile(r'^\s*EVENTLOG_EVENT\(\s*(\w+)\s*,\s*"(.*)"\s*\)')
+    events = []
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                events.append((match.group(1), match.group(2)))
+    return events
+
+
+def format_event(events, event_id, args):
+    """Formats the arguments of an event like its format describes them."""
+    if event_id >= len(events):
+        return 'unknown event %d: %s' % (event_id, args.hex(' '))
+
+    name, fmt = events[event_id]
+    offset = 0
+
+    def argument(match):
+        nonlocal offset
+        kind = match.group(1)
+        try:
+            if kind == 'u8':
+                value = str(args[offset])
+                offset += 1
+            elif kind in ('u16', 'x16'):
+                value = struct.unpack_from('<H', args, offset)[0]
+                value = ('0x%04X' % value) if kind == 'x16' else str(value)
+                offset += 2
+            elif kind == 'u32':
+                value = str(struct.unpack_from('<I', args, offset)[0])
+                offset += 4
+            elif kind == 'ip':
+                value = '.'.join(str(b) for b in args[offset:offset + 4])
+                offset += 4
+            elif kind in ('hex', 'text'):
+                length = args[offset]
+                data = args[offset + 1:offset + 1 + length]
+                offset += 1 + length
+                if kind == 'hex':
+                    value = data.hex(' ')
+                else:
+                    value = ''.join(chr(b) if 0x20 <= b < 0x7F else '.'
+                                    for b in data)
+            else:
+                return match.group(0)
+        except (IndexError, struct.error):
+            return '<truncated>'
+        return value
+
+    return re.sub(r'\{(\w+)\}', argument, fmt)
+
+
+def decode(stream, events, output):
+    """Decodes the stream until its end."""
+    state = 'text'
+    event_id = 0
+    length = 0
+    args = bytearray()
+    record = bytearray()
+
+    def emit():
+        output.write(format_event(events, event_id, bytes(args)) + '\n')
+        output.flush()
+
+    while True:
+        data = stream.read(1)
+        if not data:
+            break
+        b = data[0]
+
+        if state == 'text':
+            if b == MARKER:
+                state = 'id'
+            elif b == CAPTURE_MARKER:
+                record = bytearray()
+                state = 'record'
+            else:
+                printable = (0x20 <= b < 0x7F) or b in (0x09, 0x0A, 0x0D)
+                output.write(chr(b) if printable else '\\x%02x' % b)
+                output.flush()
+        elif state == 'id':
+            event_id = b
+            state = 'length'
+        elif state == 'length':
+            length = b
+            args = bytearray()
+            if length == 0:
+                emit()
+                state = 'text'
+            else:
+                state = 'args'
+        elif state == 'record':
+            # flags, timestamp, original and captured length, frame
+            record.append(b)
+            if len(record) >= CAPTURE_HEADER_LENGTH:
+                length = struct.unpack_from('<H', record, 7)[0]
+                if len(record) == CAPTURE_HEADER_LENGTH + length:
+                    state = 'text'
+        else:
+            args.append(b)
+            if len(args) == length:
+                emit()
+                state = 'text'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes the event-log.')
+    parser.add_argument('input', nargs='?', help='file or serial device '
+                        '(default: stdin)')
+    parser.add_argument('-b', '--baudrate', type=int, default=115200,
+                        help='baudrate of a serial device')
+    parser.add_argument('-e', '--events', default=EVENTS,
+                        help='list of the events (eventLog_events.h)')
+    arguments = parser.parse_args()
+
+    events = read_events(arguments.events)
+
+    if arguments.input is None:
+        stream = sys.stdin.buffer
+    elif arguments.input.startswith('/dev/tty'):
+        import termios
+        fd = os.open(arguments.input, os.O_RDONLY | os.O_NOCTTY)
+        attributes = termios.tcgetattr(fd)
+        speed = getattr(termios, 'B%d' % arguments.baudrate)
+        attributes[0] = 0                               # iflag
+        attributes[1] = 0                               # oflag
+        attributes[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attributes[3] = 0                               # lflag
+        attributes[4] = speed
+        attributes[5] = speed
+        termios.tcsetattr(fd, termios.TCSANOW, attributes)
+        stream = os.fdopen(fd, 'rb', buffering=0)
+    else:
+        stream = open(arguments.input, 'rb')
+
+    try:
+        decode(stream, events, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,191 @@
+/**
+ *******************************************************************************
+ * @file        io.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Replacement of <avr/io.h> for the host-build. The registers
+ *              that are used by the drivers are ordinary variables, they are
+ *              defined in io_host.c. The USART-registers are served by
+ *              usart_host.c, all other registers only hold their value.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Declares an 8-Bit-Register. io_host.c defines HOST_DEFINE_REGISTERS to
+ *  define the variables instead.
+ */
+#ifdef HOST_DEFINE_REGISTERS
+        #define HOST_REGISTER8(_name_)  volatile uint8_t _name_
+        #define HOST_REGISTER16(_name_) volatile uint16_t _name_
+#else
+        #define HOST_REGISTER8(_name_)  extern volatile uint8_t _name_
+        #define HOST_REGISTER16(_name_) extern volatile uint16_t _name_
+#endif /* HOST_DEFINE_REGISTERS */
+
+/**
+ *  Declares the registers of an USART-periphery.
+ */
+#define HOST_USART_REGISTERS(_n_)       \
+        HOST_REGISTER8(UCSR##_n_##A);   \
+        HOST_REGISTER8(UCSR##_n_##B);   \
+        HOST_REGISTER8(UCSR##_n_##C);   \
+        HOST_REGISTER8(UDR##_n_);       \
+        HOST_REGISTER16(UBRR##_n_)
+
+/**
+ *  Declares the registers of a GPIO-port.
+ */
+#define HOST_PORT_REGISTERS(_p_)        \
+        HOST_REGISTER8(DDR##_p_);       \
+        HOST_REGISTER8(PORT##_p_);      \
+        HOST_REGISTER8(PIN##_p_)
+
+/**
+ *  Declares the registers of a 16-Bit-Timer.
+ */
+#define HOST_TIMER_REGISTERS(_n_)       \
+        HOST_REGISTER8(TCCR##_n_##A);   \
+        HOST_REGISTER8(TCCR##_n_##B);   \
+        HOST_REGISTER8(TCCR##_n_##C);   \
+        HOST_REGISTER16(TCNT##_n_);     \
+        HOST_REGISTER8(TIMSK##_n_);     \
+        HOST_REGISTER8(TIFR##_n_)
+
+HOST_USART_REGISTERS(0);
+HOST_USART_REGISTERS(1);
+HOST_USART_REGISTERS(2);
+HOST_USART_REGISTERS(3);
+
+HOST_PORT_REGISTERS(A);
+HOST_PORT_REGISTERS(B);
+HOST_PORT_REGISTERS(C);
+HOST_PORT_REGISTERS(D);
+HOST_PORT_REGISTERS(E);
+HOST_PORT_REGISTERS(F);
+HOST_PORT_REGISTERS(G);
+HOST_PORT_REGISTERS(H);
+HOST_PORT_REGISTERS(J);
+HOST_PORT_REGISTERS(K);
+HOST_PORT_REGISTERS(L);
+
+HOST_TIMER_REGISTERS(1);
+HOST_TIMER_REGISTERS(3);
+HOST_TIMER_REGISTERS(4);
+HOST_TIMER_REGISTERS(5);
+
+HOST_REGISTER8(EICRA);
+HOST_REGISTER8(EICRB);
+HOST_REGISTER8(EIMSK);
+HOST_REGISTER8(EIFR);
+
+// USART: UCSRnA
+#define RXC0            7
+#define TXC0            6
+#define UDRE0           5
+#define FE0             4
+#define DOR0            3
+#define UPE0            2
+#define U2X0            1
+#define MPCM0           0
+
+// USART: UCSRnB
+#define RXCIE0          7
+#define TXCIE0          6
+#define UDRIE0          5
+#define RXEN0           4
+#define TXEN0           3
+#define UCSZ02          2
+#define RXB80           1
+#define TXB80           0
+
+// USART: UCSRnC
+#define UMSEL01         7
+#define UMSEL00         6
+#define UPM01           5
+#define UPM00           4
+#define USBS0           3
+#define UCSZ01          2
+#define UCSZ00          1
+#define UCPOL0          0
+
+// Timer: TCCRnB
+#define CS10            0
+#define CS30            0
+#define CS40            0
+#define CS50            0
+
+// Timer: TIMSKn, TIFRn
+#define TOIE1           0
+#define TOIE3           0
+#define TOIE4           0
+#define TOIE5           0
+#define TOV1            0
+#define TOV3            0
+#define TOV4            0
+#define TOV5            0
+
+// External Interrupts: EICRA, EIMSK, EIFR
+#define ISC00           0
+#define ISC01           1
+#define ISC10           2
+#define ISC11           3
+#define ISC20           4
+#define ISC21           5
+#define ISC30           6
+#define ISC31           7
+#define INT0            0
+#define INT1            1
+#define INT2            2
+#define INT3            3
+#define INTF0           0
+#define INTF1           1
+#define INTF2           2
+#define INTF3           3
+
+#define _BV(_bit_)      (1 << (_bit_))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_AVR_IO_H_ */
@@ -0,0 +1,62 @@
+/**
+ *******************************************************************************
+ * @file        pgmspace.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Replacement of <avr/pgmspace.h> for the host-build. The host
+ *              has a single address space, so the program-memory is read like
+ *              the RAM.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _HOST_AVR_PGMSPACE_H_
+#define _HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P                   const char *
+#define PSTR(_s_)               (_s_)
+
+#define pgm_read_byte(_p_)      (*(const uint8_t *)(_p_))
+#define pgm_read_word(_p_)      (*(const uint16_t *)(_p_))
+#define pgm_read_dword(_p_)     (*(const uint32_t *)(_p_))
+#define pgm_read_ptr(_p_)       (*(const void * const *)(_p_))
+
+#define memcpy_P                memcpy
+#define strlen_P                strlen
+#define strcmp_P                strcmp
+
+#endif /* _HOST_AVR_PGMSPACE_H_ */
@@ -0,0 +1,62 @@
+/**
+ *******************************************************************************
+ * @file        atomic.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Replacement of <util/atomic.h> for the host-build. Like in
+ *              avr-libc the interrupts are restored by a cleanup-function, so
+ *              a return inside of the block is allowed.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _HOST_UTIL_ATOMIC_H_
+#define _HOST_UTIL_ATOMIC_H_
+
+#include "../../avr_host.h"
+
+#define ATOMIC_RESTORESTATE                                             \
+        uint8_t host_state__                                            \
+                __attribute__((__cleanup__(host_atomicRestoreState))) = \
+                host_getInterruptState()
+
+#define ATOMIC_FORCEON                                                  \
+        uint8_t host_state__                                            \
+                __attribute__((__cleanup__(host_atomicForceOn))) = 0
+
+#define ATOMIC_BLOCK(_type_)                                            \
+        for (_type_, host_todo__ = host_atomicBegin();                  \
+             host_todo__;                                               \
+             host_todo__ = 0)
+
+#endif /* _HOST_UTIL_ATOMIC_H_ */
@@ -0,0 +1,164 @@
+/**
+ *******************************************************************************
+ * @file        main_host.cpp
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Main-file of the host-build. It connects the emulated
+ *              USART-peripheries and runs setup and loop of
+ *              PPP_NetworkDriver.ino like the Arduino-core.                  @n
+ *              Usage: ppp_host [-p] [-0 endpoint] [-1 endpoint]
+ *                              [-2 endpoint] [-3 endpoint] [-b n:baudrate]   @n
+ *              -n endpoint  : Endpoint of USARTn (see usartHost_open). The
+ *                             defaults are stdio for USART0 (serialConsole)
+ *                             and pty for USART1 (PPP).                      @n
+ *              -b n:baudrate: Paces USARTn by this baudrate instead of
+ *                             UBRR.                                          @n
+ *              -p           : Starts a second instance whose USART1 is
+ *                             connected to USART1 by a socketpair, its
+ *                             serialConsole is printed to stderr.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "usart_host.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// functions of PPP_NetworkDriver.ino
+void setup();
+void loop();
+
+// private function prototypes
+static void printUsage(const char *name);
+static bool startPair(const char **endpoints);
+
+int main(int argc, char *argv[])
+{
+        const char *endpoints[USART_HOST_COUNT] = {"stdio", "pty", "none",
+                                                   "none"};
+        bool isPair = false;
+        int option;
+        uint8_t i;
+
+        while ((option = getopt(argc, argv, "0:1:2:3:b:ph")) != -1) {
+                switch (option) {
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                        endpoints[option - '0'] = optarg;
+                        break;
+                case 'b': {
+                        char *end;
+                        unsigned long usart = strtoul(optarg, &end, 10);
+
+                        if ((*end != ':') || (usart >= USART_HOST_COUNT)) {
+                                printUsage(argv[0]);
+                                return EXIT_FAILURE;
+                        }
+                        usartHost_setBaudrate((uint8_t)usart,
+                                              strtoul(end + 1, NULL, 10));
+                        break;
+                }
+                case 'p':
+                        isPair = true;
+                        break;
+                default:
+                        printUsage(argv[0]);
+                        return EXIT_FAILURE;
+                }
+        }
+
+        if (isPair && !startPair(endpoints))
+                return EXIT_FAILURE;
+
+        for (i = 0; i < USART_HOST_COUNT; i++) {
+                if ((strcmp(endpoints[i], "none") != 0) &&
+                    !usartHost_open(i, endpoints[i]))
+                        return EXIT_FAILURE;
+        }
+
+        usartHost_start();
+
+        setup();
+        for (;;)
+                loop();
+}
+
+// private functions
+static void printUsage(const char *name)
+{
+        fprintf(stderr,
+                "Usage: %s [-p] [-0 endpoint] [-1 endpoint] [-2 endpoint] "
+                "[-3 endpoint] [-b n:baudrate]\n"
+                "endpoint: pty | stdio | stderr | fd:<n> | none\n",
+                name);
+}
+
+static bool startPair(const char **endpoints)
+{
+        static char endpoint[16];
+        int sockets[2];
+        pid_t pid;
+
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) < 0) {
+                perror("socketpair");
+                return false;
+        }
+
+        pid = fork();
+        if (pid < 0) {
+                perror("fork");
+                return false;
+        }
+
+        if (pid == 0) {
+                // the second instance ends with the first one
+                prctl(PR_SET_PDEATHSIG, SIGTERM);
+                close(sockets[0]);
+                snprintf(endpoint, sizeof(endpoint), "fd:%d", sockets[1]);
+                endpoints[0] = "stderr";
+        } else {
+                close(sockets[1]);
+                snprintf(endpoint, sizeof(endpoint), "fd:%d", sockets[0]);
+        }
+        endpoints[1] = endpoint;
+
+        return true;
+}
@@ -0,0 +1,390 @@
+/**
+ *******************************************************************************
+ * @file        usart_host.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the emulated USART-peripheries of the
+ *              host-build.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#define _GNU_SOURCE
+
+#include "usart_host.h"
+#include "avr_host.h"
+
+#include "..\\system.h"
+#include "..\\driver\\usart\\usart.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ *  This structure holds the registers and the endpoint of an emulated
+ *  USART-periphery.
+ */
+struct port_t {
+        volatile uint8_t               *ucsra;
+        volatile uint8_t               *ucsrb;
+        volatile uint8_t               *ucsrc;
+        volatile uint8_t               *udr;
+        volatile uint16_t              *ubrr;
+
+        /**
+         * Instance of the usart-driver, NULL if it is not linked.
+         */
+        struct usart_t                 *instance;
+
+        void                          (*rxVector)(void);
+        void                          (*udreVector)(void);
+
+        int                             rxFd;
+        int                             txFd;
+
+        /**
+         * Slave of the pseudo-terminal, it is kept open so the master does
+         * not lose its settings while no other program has opened it.
+         */
+        int                             ptySlaveFd;
+
+        /**
+         * Baudrate that paces the Bytes, 0 to use UBRR.
+         */
+        uint32_t                        baudrate;
+
+        /**
+         * Time in ns when the next Byte can be received or transmitted.
+         */
+        uint64_t                        rxNext;
+        uint64_t                        txNext;
+};
+
+/**
+ *  Declares the interrupt service routines and the instance of an
+ *  USART-periphery. They are weak, so a periphery that is not linked is
+ *  NULL.
+ */
+#define DECLARE_USART(_n_)                                                 \
+        extern struct usart_t usart##_n_##_instance __attribute__((weak)); \
+        void USART##_n_##_RX_vect(void) __attribute__((weak));             \
+        void USART##_n_##_UDRE_vect(void) __attribute__((weak))
+
+/**
+ *  Initializes the port_t of an USART-periphery.
+ */
+#define PORT_INITIALIZER(_n_)                                   \
+        {                                                       \
+                .ucsra = &UCSR##_n_##A,                         \
+                .ucsrb = &UCSR##_n_##B,                         \
+                .ucsrc = &UCSR##_n_##C,                         \
+                .udr = &UDR##_n_,                               \
+                .ubrr = &UBRR##_n_,                             \
+                .instance = &usart##_n_##_instance,             \
+                .rxVector = USART##_n_##_RX_vect,               \
+                .udreVector = USART##_n_##_UDRE_vect,           \
+                .rxFd = -1,                                     \
+                .txFd = -1,                                     \
+                .ptySlaveFd = -1,                               \
+        }
+
+DECLARE_USART(0);
+DECLARE_USART(1);
+DECLARE_USART(2);
+DECLARE_USART(3);
+
+// private function prototypes
+static bool openPty(struct port_t *port, uint8_t usart);
+static void interruptHandler(int signal);
+static void servePort(struct port_t *port, uint64_t now);
+static uint64_t getByteTime(const struct port_t *port);
+static bool readByte(struct port_t *port, uint8_t *b);
+static bool writeByte(struct port_t *port, uint8_t b);
+static uint64_t getTime(void);
+
+// private data
+static struct port_t ports[USART_HOST_COUNT] = {
+        PORT_INITIALIZER(0),
+        PORT_INITIALIZER(1),
+        PORT_INITIALIZER(2),
+        PORT_INITIALIZER(3),
+};
+
+// public functions
+bool usartHost_open(uint8_t usart, const char *endpoint)
+{
+        struct port_t *port;
+
+        if (usart >= USART_HOST_COUNT)
+                return false;
+        port = &ports[usart];
+
+        if ((port->instance == NULL) || (port->rxVector == NULL) ||
+            (port->udreVector == NULL)) {
+                fprintf(stderr, "usart%u: not used by the program\n", usart);
+                return false;
+        }
+        if (!(port->instance->description->options & USART_OPTION_TX_UDRE)) {
+                fprintf(stderr, "usart%u: USART%u_TX_UDRE is required\n",
+                        usart, usart);
+                return false;
+        }
+
+        if (strcmp(endpoint, "pty") == 0)
+                return openPty(port, usart);
+
+        if (strcmp(endpoint, "stdio") == 0) {
+                port->rxFd = STDIN_FILENO;
+                port->txFd = STDOUT_FILENO;
+        } else if (strcmp(endpoint, "stderr") == 0) {
+                port->rxFd = -1;
+                port->txFd = STDERR_FILENO;
+        } else if (strncmp(endpoint, "fd:", 3) == 0) {
+                char *end;
+                long fd = strtol(endpoint + 3, &end, 10);
+
+                if ((*end != '\0') || (fd < 0) ||
+                    (fcntl((int)fd, F_GETFD) < 0)) {
+                        fprintf(stderr, "usart%u: invalid %s\n",
+                                usart, endpoint);
+                        return false;
+                }
+                port->rxFd = (int)fd;
+                port->txFd = (int)fd;
+        } else if (strcmp(endpoint, "none") == 0) {
+                port->rxFd = -1;
+                port->txFd = -1;
+        } else {
+                fprintf(stderr, "usart%u: unknown endpoint %s\n",
+                        usart, endpoint);
+                return false;
+        }
+
+        return true;
+}
+
+void usartHost_setBaudrate(uint8_t usart, uint32_t baudrate)
+{
+        if (usart < USART_HOST_COUNT)
+                ports[usart].baudrate = baudrate;
+}
+
+void usartHost_start(void)
+{
+        struct sigaction action;
+        struct itimerval timer;
+
+        // a closed socket is handled by writeByte
+        signal(SIGPIPE, SIG_IGN);
+
+        // the handler blocks the signal, so the interrupts are not nested
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = interruptHandler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(HOST_INTERRUPT_SIGNAL, &action, NULL);
+
+        timer.it_interval.tv_sec = 0;
+        timer.it_interval.tv_usec = USART_HOST_TICK_US;
+        timer.it_value = timer.it_interval;
+        setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+// private functions
+static bool openPty(struct port_t *port, uint8_t usart)
+{
+        struct termios settings;
+        const char *name;
+        int master;
+        int slave;
+
+        master = posix_openpt(O_RDWR | O_NOCTTY);
+        if ((master < 0) || (grantpt(master) < 0) || (unlockpt(master) < 0) ||
+            ((name = ptsname(master)) == NULL)) {
+                perror("posix_openpt");
+                return false;
+        }
+
+        slave = open(name, O_RDWR | O_NOCTTY);
+        if (slave < 0) {
+                perror(name);
+                close(master);
+                return false;
+        }
+        // raw Bytes until the other program sets its own mode
+        if (tcgetattr(slave, &settings) == 0) {
+                cfmakeraw(&settings);
+                tcsetattr(slave, TCSANOW, &settings);
+        }
+
+        port->rxFd = master;
+        port->txFd = master;
+        port->ptySlaveFd = slave;
+        fprintf(stderr, "usart%u: %s\n", usart, name);
+
+        return true;
+}
+
+static void interruptHandler(int signal)
+{
+        int savedErrno = errno;
+        uint64_t now = getTime();
+        uint8_t i;
+
+        UNUSED_ARG(signal);
+
+        host_serveTimers();
+        for (i = 0; i < USART_HOST_COUNT; i++)
+                servePort(&ports[i], now);
+
+        errno = savedErrno;
+}
+
+static void servePort(struct port_t *port, uint64_t now)
+{
+        const uint8_t rxEnabled = (1 << RXEN0) | (1 << RXCIE0);
+        uint64_t byteTime;
+        uint8_t b;
+
+        // the driver has not initialized the periphery yet
+        if (!(*port->ucsrb & (1 << TXEN0)))
+                return;
+
+        byteTime = getByteTime(port);
+
+        // Transmitter: UDR holds the next Byte while UDRIE is set
+        if (port->txNext + byteTime < now)
+                port->txNext = now;
+        while ((*port->ucsrb & (1 << UDRIE0)) && (port->txNext <= now)) {
+                if (!writeByte(port, *port->udr))
+                        break;
+                port->txNext += byteTime;
+                port->udreVector();
+        }
+
+        // Receiver
+        if (port->rxNext + byteTime < now)
+                port->rxNext = now;
+        while (((*port->ucsrb & rxEnabled) == rxEnabled) &&
+               (port->rxNext <= now) && readByte(port, &b)) {
+                bool txIsPending = *port->ucsrb & (1 << UDRIE0);
+                uint8_t txData = *port->udr;
+
+                // the real UDR has separate buffers for RX and TX
+                *port->udr = b;
+                port->rxNext += byteTime;
+                port->rxVector();
+                if (txIsPending)
+                        *port->udr = txData;
+        }
+}
+
+static uint64_t getByteTime(const struct port_t *port)
+{
+        uint32_t baudrate = port->baudrate;
+        uint8_t ucsrc = *port->ucsrc;
+        uint8_t bits;
+
+        if (baudrate == 0) {
+                uint32_t divider = (*port->ucsra & (1 << U2X0)) ? 8 : 16;
+
+                baudrate = F_CPU / (divider * ((uint32_t)*port->ubrr + 1));
+        }
+
+        // Start-Bit, Data-Bits, Parity-Bit and Stop-Bits
+        if (*port->ucsrb & (1 << UCSZ02))
+                bits = 1 + 9;
+        else
+                bits = 1 + 5 + ((ucsrc >> UCSZ00) & 0x03);
+        if (ucsrc & (1 << UPM01))
+                bits++;
+        bits += (ucsrc & (1 << USBS0)) ? 2 : 1;
+
+        return (uint64_t)bits * 1000000000ULL / baudrate;
+}
+
+static bool readByte(struct port_t *port, uint8_t *b)
+{
+        struct pollfd request = {.fd = port->rxFd, .events = POLLIN};
+        ssize_t result;
+
+        if ((port->rxFd < 0) || (poll(&request, 1, 0) <= 0) ||
+            !(request.revents & (POLLIN | POLLHUP)))
+                return false;
+
+        result = read(port->rxFd, b, 1);
+        if (result == 0) {
+                // end of file, the other side is closed
+                port->rxFd = -1;
+                return false;
+        }
+
+        return result == 1;
+}
+
+static bool writeByte(struct port_t *port, uint8_t b)
+{
+        struct pollfd request = {.fd = port->txFd, .events = POLLOUT};
+
+        // no endpoint, the Byte is discarded
+        if (port->txFd < 0)
+                return true;
+
+        if ((poll(&request, 1, 0) <= 0) || !(request.revents & POLLOUT)) {
+                if (request.revents & (POLLERR | POLLHUP | POLLNVAL))
+                        port->txFd = -1;
+                // the endpoint is busy, like a HIGH CTS-Input
+                return port->txFd < 0;
+        }
+
+        if ((write(port->txFd, &b, 1) < 0) && (errno != EAGAIN))
+                port->txFd = -1;
+
+        return true;
+}
+
+static uint64_t getTime(void)
+{
+        struct timespec now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
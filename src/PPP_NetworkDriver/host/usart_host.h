@@ -0,0 +1,114 @@
+/**
+ *******************************************************************************
+ * @file        usart_host.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the emulated USART-peripheries of the
+ *              host-build.
+ *              The unmodified usart-driver writes and reads the registers of
+ *              <avr/io.h>, this module connects them to file-descriptors:
+ *              a pseudo-terminal (e.g. for pppd), a socketpair to a second
+ *              instance or stdin/stdout. The interrupt service routines of
+ *              the driver are called by the emulated interrupt
+ *              (HOST_INTERRUPT_SIGNAL) and the Bytes are paced by the
+ *              baudrate, which is calculated from UBRR, U2X and the
+ *              frame-format like on the Microprocessor.                      @n
+ *              Only the Data-Register-Empty-Interrupt (USARTn_TX_UDRE) is
+ *              supported. The CTS-Input stays LOW, so the flow-control never
+ *              pauses the transmission.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _USART_HOST_H_
+#define _USART_HOST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Number of emulated USART-peripheries.
+ */
+#define USART_HOST_COUNT (4)
+
+/**
+ *  Period of the emulated interrupt in microseconds. The Bytes of all
+ *  USART-peripheries are served at this rate, several Bytes per period if
+ *  the baudrate requires it.
+ */
+#define USART_HOST_TICK_US (50)
+
+/**
+ *  Connects an USART-periphery to an endpoint. The possible endpoints are:   @n
+ *  "pty"    -> A new pseudo-terminal, its name is printed to stderr.         @n
+ *  "stdio"  -> RX from stdin, TX to stdout.                                  @n
+ *  "stderr" -> TX to stderr, no RX.                                          @n
+ *  "fd:<n>" -> An open file-descriptor, e.g. a socket of a socketpair.       @n
+ *  "none"   -> TX is discarded, no RX (default).
+ *  @param      usart: Number of the USART-periphery (0 .. 3).
+ *  @param      endpoint: Name of the endpoint.
+ *  @return     False if the endpoint can not be opened or the
+ *              USART-periphery is not used by the program.
+ *  @pre        usartHost_start has not been called.
+ *  @post       None.
+ */
+bool usartHost_open(uint8_t usart, const char *endpoint);
+
+/**
+ *  Sets the baudrate that paces the Bytes instead of the one of UBRR.
+ *  @param      usart: Number of the USART-periphery (0 .. 3).
+ *  @param      baudrate: Baudrate or 0 to use UBRR again.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       None.
+ */
+void usartHost_setBaudrate(uint8_t usart, uint32_t baudrate);
+
+/**
+ *  Starts the emulated interrupt.
+ *  @return     None.
+ *  @pre        The endpoints are opened.
+ *  @post       The interrupt service routines are called as soon as the
+ *              usart-driver enables the interrupts of an USART-periphery.
+ */
+void usartHost_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _USART_HOST_H_ */
@@ -0,0 +1,173 @@
+/**
+ *******************************************************************************
+ * @file        capture.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the frame-capture.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "capture.h"
+#include "capture_cfg.h"
+#include "databuffer.h"
+#include "serialConsole.h"
+#include "timebase.h"
+
+#include "..\\system.h"
+
+#include <string.h>
+
+/**
+ *  Marker, flags, timestamp, original length and captured length.
+ */
+#define CAPTURE_RECORD_HEADER_LENGTH    (10)
+
+// private function prototypes
+static bool hasProgmem(struct databuffer_basic_t *chain);
+
+// data
+static bool                        isEnabled;
+static struct capture_statistics_t statistics;
+
+// public functions
+void capture_init(void)
+{
+#ifdef CAPTURE_AT_START
+        isEnabled = true;
+#else
+        isEnabled = false;
+#endif /* CAPTURE_AT_START */
+        capture_resetStatistics();
+}
+
+void capture_setEnabled(bool enable)
+{
+        isEnabled = enable;
+}
+
+bool capture_isEnabled(void)
+{
+        return isEnabled;
+}
+
+void capture_write(uint8_t flags,
+                   const void *header,
+                   uint8_t headerLength,
+                   struct databuffer_basic_t *chain)
+{
+        struct mempool_statistics_t pool;
+        struct databuffer_basic_t *record;
+        struct databuffer_basic_t *data = NULL;
+        uint32_t timestamp;
+        uint16_t originalLength;
+        uint16_t capturedLength;
+        uint16_t dataLength;
+        uint8_t *p;
+
+        if (!isEnabled)
+                return;
+
+        timestamp = timebase_getMicros();
+        originalLength = headerLength + databuffer_getTotalLength(chain);
+        dataLength = min(originalLength, (uint16_t)CAPTURE_SNAPLEN) -
+                     headerLength;
+
+        record = databuffer_alloc(CAPTURE_RECORD_HEADER_LENGTH + headerLength);
+        if (record == NULL) {
+                statistics.drops++;
+                return;
+        }
+
+        if ((dataLength <= databuffer_getTailroom(record)) || hasProgmem(chain)) {
+                // the UART can not read the program-memory, the rest of a
+                // long frame in the program-memory is truncated
+                dataLength = min(dataLength, databuffer_getTailroom(record));
+                databuffer_put(record, dataLength);
+                databuffer_copy_partial(record,
+                                        CAPTURE_RECORD_HEADER_LENGTH +
+                                        headerLength,
+                                        chain,
+                                        0,
+                                        dataLength);
+        } else {
+                // the shared Data-Block is held until the transmission
+                databuffer_getPoolStatistics(DATABUFFER_POOL_LARGEBLOCK, &pool);
+                if (pool.numberOfBlocks - pool.numberOfUsedBlocks >=
+                    CAPTURE_POOL_RESERVE)
+                        data = databuffer_clone_partial(chain, 0, dataLength);
+                if (data == NULL) {
+                        databuffer_free(record);
+                        statistics.drops++;
+                        return;
+                }
+        }
+        capturedLength = headerLength + dataLength;
+
+        p = record->data;
+        p[0] = CAPTURE_MARKER;
+        p[1] = flags;
+        memcpy(&p[2], &timestamp, sizeof(timestamp));
+        memcpy(&p[6], &originalLength, sizeof(originalLength));
+        memcpy(&p[8], &capturedLength, sizeof(capturedLength));
+        memcpy(&p[CAPTURE_RECORD_HEADER_LENGTH], header, headerLength);
+        if (data != NULL)
+                databuffer_insertAtEnd(record, data);
+
+        // the serial console releases the record
+        if (serialConsole_txChain(record))
+                statistics.frames++;
+        else
+                statistics.drops++;
+}
+
+void capture_getStatistics(struct capture_statistics_t *statisticsCopy)
+{
+        *statisticsCopy = statistics;
+}
+
+void capture_resetStatistics(void)
+{
+        memset(&statistics, 0, sizeof(statistics));
+}
+
+// private functions
+static bool hasProgmem(struct databuffer_basic_t *chain)
+{
+        for (; chain != NULL; chain = chain->next) {
+                if (databuffer_isProgmem(chain))
+                        return true;
+        }
+
+        return false;
+}
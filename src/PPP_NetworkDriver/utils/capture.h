@@ -0,0 +1,155 @@
+/**
+ *******************************************************************************
+ * @file        capture.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the frame-capture. The frames of the
+ *              Data-Link-Layer are transmitted with a timestamp over the
+ *              serial console, and host/capture_pcap.py writes them into a
+ *              pcap-file (DLT_PPP_SERIAL) for Wireshark.                     @n
+ *              A record is transmitted as CAPTURE_MARKER, the flags, the
+ *              timestamp in microseconds (4 Bytes), the original length and
+ *              the captured length (2 Bytes each) and the captured Bytes.
+ *              The numbers are little-endian.                                @n
+ *              The records are queued as DataBuffer-Chains by
+ *              serialConsole_txChain, a record is dropped if that queue is
+ *              full or the DataBuffer-Pools run short. The capture never
+ *              waits for the serial console.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#include "..\\system.h"
+
+#include "databuffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  First Byte of a record on the serial console (ASCII Group-Separator), it
+ *  separates the records from the events (EVENTLOG_MARKER) and other output.
+ */
+#define CAPTURE_MARKER (0x1D)
+
+/**
+ *  Flag of a record: the frame had been transmitted, otherwise received.
+ */
+#define CAPTURE_FLAG_TX (0x01)
+
+/**
+ *  This structure holds a snapshot of the counters of the frame-capture.
+ */
+struct capture_statistics_t {
+        /**
+         * Number of records that had been queued for the serial console.
+         */
+        uint16_t                        frames;
+
+        /**
+         * Number of frames that had been dropped.
+         */
+        uint16_t                        drops;
+};
+
+/**
+ *  Initializes the frame-capture.
+ *  @return     None.
+ *  @pre        The functions databuffer_init, serialConsole_init and
+ *              timebase_init had been called.
+ *  @post       The frame-capture is initialized and enabled if
+ *              CAPTURE_AT_START is defined.
+ */
+void capture_init(void);
+
+/**
+ *  Enables or disables the frame-capture.
+ *  @param      isEnabled: true to capture the frames.
+ *  @return     None.
+ *  @pre        capture_init has been called.
+ *  @post       None.
+ */
+void capture_setEnabled(bool isEnabled);
+
+/**
+ *  Checks if the frame-capture is enabled.
+ *  @return     true if the frames are captured.
+ *  @pre        capture_init has been called.
+ *  @post       None.
+ */
+bool capture_isEnabled(void);
+
+/**
+ *  Captures a frame. Short frames and data in the program-memory are copied,
+ *  the data of long frames is shared with the DataBuffer-Chain.
+ *  @param      flags: Flags of the record, e.g. CAPTURE_FLAG_TX.
+ *  @param      header: Header of the Data-Link-Layer in front of the chain,
+ *                      e.g. the address and control field of PPP.
+ *  @param      headerLength: Number of Bytes of the header.
+ *  @param      chain: DataBuffer-Chain of the frame, it stays with the caller.
+ *  @return     None.
+ *  @pre        capture_init has been called and headerLength is less than
+ *              CAPTURE_SNAPLEN.
+ *  @post       None.
+ */
+void capture_write(uint8_t flags,
+                   const void *header,
+                   uint8_t headerLength,
+                   struct databuffer_basic_t *chain);
+
+/**
+ *  Copies the counters of the frame-capture.
+ *  @param      statistics: Buffer that will hold the counters.
+ *  @return     None.
+ *  @pre        capture_init has been called.
+ *  @post       None.
+ */
+void capture_getStatistics(struct capture_statistics_t *statistics);
+
+/**
+ *  Sets the counters of the frame-capture to 0.
+ *  @return     None.
+ *  @pre        capture_init has been called.
+ *  @post       None.
+ */
+void capture_resetStatistics(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _CAPTURE_H_ */
@@ -0,0 +1,66 @@
+/**
+ *******************************************************************************
+ * @file        capture_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file of the frame-capture.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _CAPTURE_CFG_H_
+#define _CAPTURE_CFG_H_
+
+/**
+ *  Maximum number of Bytes of a frame that are captured, including the
+ *  header of the Data-Link-Layer. The rest is truncated, the record keeps
+ *  the original length.                                                      @n
+ *  At 115200 Baud the serial console transmits 11.5 Bytes per millisecond.
+ */
+#define CAPTURE_SNAPLEN (128)
+
+/**
+ *  Number of large Data-Blocks that must stay free for the reception. A
+ *  long frame is captured without a copy, so its Data-Block is held until
+ *  the serial console has transmitted it. The frame is dropped instead if
+ *  less Data-Blocks are free.
+ */
+#define CAPTURE_POOL_RESERVE (1)
+
+/**
+ *  Uncomment this Define to capture from the start, otherwise the capture
+ *  has to be enabled by capture_setEnabled (shell: "pcap 1").
+ */
+//#define CAPTURE_AT_START
+
+#endif /* _CAPTURE_CFG_H_ */
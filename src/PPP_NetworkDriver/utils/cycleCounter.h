@@ -0,0 +1,94 @@
+/**
+ *******************************************************************************
+ * @file        cycleCounter.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Free-running 16-Bit-Timer that counts the CPU-cycles, e.g. to
+ *              measure the run-time of interrupt service routines. The
+ *              counter overflows every 65536 cycles (4.1 ms at 16 MHz), so
+ *              only shorter intervals can be measured.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _CYCLECOUNTER_H_
+#define _CYCLECOUNTER_H_
+
+#include "..\\system.h"
+#include "cycleCounter_cfg.h"
+
+#if (CYCLECOUNTER_TIMER != 1) && (CYCLECOUNTER_TIMER != 3) && \
+    (CYCLECOUNTER_TIMER != 4) && (CYCLECOUNTER_TIMER != 5)
+        #error "Illegal setting of CYCLECOUNTER_TIMER! Should be 1, 3, 4 or 5."
+#endif
+
+/**
+ *  Counter-Register of the selected Timer.
+ */
+#define CYCLECOUNTER_TCNT CONCAT2(TCNT, CYCLECOUNTER_TIMER)
+
+/**
+ *  Starts the Timer in normal mode without prescaler. Calling it again does
+ *  not disturb a running measurement.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The counter is incremented each CPU-cycle.
+ */
+#define cycleCounter_init()                                            \
+        do {                                                           \
+                CONCAT3(TCCR, CYCLECOUNTER_TIMER, A) = 0;              \
+                CONCAT3(TCCR, CYCLECOUNTER_TIMER, B) =                 \
+                        (1 << CONCAT3(CS, CYCLECOUNTER_TIMER, 0));     \
+        } while (0)
+
+/**
+ *  Returns the current value of the counter. The 16-Bit-Register is read
+ *  with the temporary register of the Timer, an interrupt service routine
+ *  that accesses the same Timer must not interrupt this read.
+ *  @return     Counter-Value in CPU-cycles.
+ *  @pre        cycleCounter_init has been called.
+ *  @post       None.
+ */
+#define cycleCounter_read()     ((uint16_t)CYCLECOUNTER_TCNT)
+
+/**
+ *  Returns the number of CPU-cycles since a previous counter-value.
+ *  @param      _start_: Counter-Value of cycleCounter_read.
+ *  @return     Elapsed CPU-cycles (modulo 65536).
+ *  @pre        cycleCounter_init has been called.
+ *  @post       None.
+ */
+#define cycleCounter_elapsed(_start_) \
+        ((uint16_t)(cycleCounter_read() - (uint16_t)(_start_)))
+
+#endif /* _CYCLECOUNTER_H_ */
@@ -0,0 +1,54 @@
+/**
+ *******************************************************************************
+ * @file        cycleCounter_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file of the cycle-counter.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _CYCLECOUNTER_CFG_H_
+#define _CYCLECOUNTER_CFG_H_
+
+/**
+ *  Number of the 16-Bit-Timer that counts the CPU-cycles.                    @n
+ *  Possible values are:                                                      @n
+ *  1 -> Timer1 (Arduino Mega: PWM of Pin 11 and 12 is lost)                  @n
+ *  3 -> Timer3 (Arduino Mega: PWM of Pin 2, 3 and 5 is lost)                 @n
+ *  4 -> Timer4 (Arduino Mega: PWM of Pin 6, 7 and 8 is lost)                 @n
+ *  5 -> Timer5 (Arduino Mega: PWM of Pin 44, 45 and 46 is lost)
+ */
+#define CYCLECOUNTER_TIMER 4
+
+#endif /* _CYCLECOUNTER_CFG_H_ */
@@ -1,11 +1,27 @@
 /**
  *******************************************************************************
  * @file        databuffer.c
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Sorce-file to handle chained databuffers.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added pools for DataBuffer-Elements and
+ *                         Data-Blocks. (MS)
+ *                      -# Added reference-counted Data-Blocks and
+ *                         databuffer_clone. (MS)
+ *                      -# Added headroom/tailroom-handling (push, pull, put
+ *                         and trim). (MS)
+ *                      -# Added cursor to access fields across segment
+ *                         boundaries. (MS)
+ *                      -# Added linearize and coalesce. (MS)
+ *                      -# Added the compact layout without backward links
+ *                         and total lengths (DATABUFFER_COMPACT). (MS)
+ *                      -# Added DataBuffer-Elements with Data-Arrays in the
+ *                         program-memory (DATABUFFER_FLAG_PROGMEM). (MS)
+ *                      -# Added databuffer_queue_t. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# No typedefs for struct and enum. (MS)
  *
@@ -45,10 +61,416 @@
  */
 
 #include "databuffer.h"
+#include "databuffer_cfg.h"
 
 #include "..\\system.h"
+#include "mempool.h"
+
+#include <string.h>
+#include <util/atomic.h>
+
+#define DATABUFFER_SMALLBLOCK_SIZE      \
+        (sizeof(struct databuffer_block_t) + DATABUFFER_POOL_SMALLBLOCK_SIZE)
+#define DATABUFFER_LARGEBLOCK_SIZE      \
+        (sizeof(struct databuffer_block_t) + DATABUFFER_POOL_LARGEBLOCK_SIZE)
 
+#ifdef DATABUFFER_COMPACT
+        // there is neither a backward link nor a total length to maintain
+        #define SETPREV(_segment_, _prev_)      \
+                ((void)(_prev_))
+        #define databuffer_adjustLength(_chain_)        \
+                ((void)(_chain_))
+#else
+        #define SETPREV(_segment_, _prev_)      \
+                ((_segment_)->prev = (_prev_))
 void databuffer_adjustLength(struct databuffer_basic_t* chain);
+#endif /* DATABUFFER_COMPACT */
+static struct databuffer_block_t *allocBlock(uint16_t size);
+static void releaseBlock(struct databuffer_block_t *block);
+static void advanceCursor(struct databuffer_cursor_t *cursor, uint16_t length);
+static uint8_t *takeContiguous(struct databuffer_cursor_t *cursor,
+                               uint16_t length,
+                               bool writable);
+static uint8_t queueIndex(struct databuffer_queue_t *queue, uint8_t offset);
+
+// data
+MEMPOOL_STORAGE(segmentStorage,
+                sizeof(struct databuffer_basic_t),
+                DATABUFFER_POOL_SEGMENTS);
+MEMPOOL_STORAGE(smallBlockStorage,
+                DATABUFFER_SMALLBLOCK_SIZE,
+                DATABUFFER_POOL_SMALLBLOCKS);
+MEMPOOL_STORAGE(largeBlockStorage,
+                DATABUFFER_LARGEBLOCK_SIZE,
+                DATABUFFER_POOL_LARGEBLOCKS);
+static struct mempool_t segmentPool;
+static struct mempool_t smallBlockPool;
+static struct mempool_t largeBlockPool;
+static struct databuffer_statistics_t chainStatistics;
+
+// public functions
+void databuffer_init(void)
+{
+        mempool_init(&segmentPool,
+                     segmentStorage,
+                     sizeof(struct databuffer_basic_t),
+                     DATABUFFER_POOL_SEGMENTS);
+        mempool_init(&smallBlockPool,
+                     smallBlockStorage,
+                     DATABUFFER_SMALLBLOCK_SIZE,
+                     DATABUFFER_POOL_SMALLBLOCKS);
+        mempool_init(&largeBlockPool,
+                     largeBlockStorage,
+                     DATABUFFER_LARGEBLOCK_SIZE,
+                     DATABUFFER_POOL_LARGEBLOCKS);
+
+        databuffer_resetStatistics();
+}
+
+struct databuffer_basic_t *databuffer_allocSegment(void)
+{
+        struct databuffer_basic_t *segment = mempool_alloc(&segmentPool);
+
+        databuffer_create(segment, NULL, 0);
+
+        return segment;
+}
+
+struct databuffer_basic_t *databuffer_allocP(const uint8_t *data,
+                                             uint16_t length)
+{
+        struct databuffer_basic_t *segment = mempool_alloc(&segmentPool);
+
+        databuffer_createP(segment, data, length);
+
+        return segment;
+}
+
+struct databuffer_basic_t *databuffer_alloc(uint16_t size)
+{
+        struct databuffer_basic_t *segment;
+
+        segment = databuffer_allocWithHeadroom(0, size);
+        if (segment != NULL)
+                databuffer_put(segment, size);
+
+        return segment;
+}
+
+struct databuffer_basic_t *databuffer_allocWithHeadroom(uint16_t headroom,
+                                                        uint16_t size)
+{
+        struct databuffer_basic_t *segment;
+        struct databuffer_block_t *block;
+
+        if ((uint32_t)headroom + size > DATABUFFER_POOL_LARGEBLOCK_SIZE)
+                return NULL;
+
+        segment = databuffer_allocSegment();
+        if (segment == NULL)
+                return NULL;
+
+        block = allocBlock(headroom + size);
+        if (block == NULL) {
+                mempool_free(&segmentPool, segment);
+                return NULL;
+        }
+
+        databuffer_create(segment, block->data + headroom, size);
+        segment->block = block;
+
+        // headroom only reserves space, the element is filled by put
+        databuffer_trim(segment, 0);
+
+        return segment;
+}
+
+uint16_t databuffer_getTailroom(struct databuffer_basic_t *segment)
+{
+        uint16_t blockSize;
+
+        if (segment->block == NULL)
+                return 0;
+
+        if (mempool_contains(&smallBlockPool, segment->block))
+                blockSize = DATABUFFER_POOL_SMALLBLOCK_SIZE;
+        else
+                blockSize = DATABUFFER_POOL_LARGEBLOCK_SIZE;
+
+        return blockSize - databuffer_getHeadroom(segment) - segment->length;
+}
+
+uint8_t *databuffer_push(struct databuffer_basic_t *segment, uint16_t length)
+{
+        if ((databuffer_getHeadroom(segment) < length) ||
+            databuffer_isShared(segment))
+                return NULL;
+
+        segment->data -= length;
+        segment->length += length;
+        databuffer_adjustLength(segment);
+
+        return segment->data;
+}
+
+uint8_t *databuffer_pull(struct databuffer_basic_t *segment, uint16_t length)
+{
+        if (segment->length < length)
+                return NULL;
+
+        segment->data += length;
+        segment->length -= length;
+        databuffer_adjustLength(segment);
+
+        return segment->data;
+}
+
+uint8_t *databuffer_put(struct databuffer_basic_t *segment, uint16_t length)
+{
+        uint8_t *tail = segment->data + segment->length;
+
+        if ((databuffer_getTailroom(segment) < length) ||
+            databuffer_isShared(segment))
+                return NULL;
+
+        segment->length += length;
+        databuffer_adjustLength(segment);
+
+        return tail;
+}
+
+void databuffer_trim(struct databuffer_basic_t *segment, uint16_t length)
+{
+        if (segment->length > length) {
+                segment->length = length;
+                databuffer_adjustLength(segment);
+        }
+}
+
+void databuffer_free(struct databuffer_basic_t *chain)
+{
+        struct databuffer_basic_t *next;
+
+        while (chain != NULL) {
+                next = chain->next;
+
+                if (chain->block != NULL) {
+                        releaseBlock(chain->block);
+                        chain->block = NULL;
+                }
+
+                if (mempool_contains(&segmentPool, chain))
+                        mempool_free(&segmentPool, chain);
+
+                chain = next;
+        }
+}
+
+struct databuffer_basic_t *databuffer_clone_partial(struct databuffer_basic_t *chain,
+                                                    uint16_t offset,
+                                                    uint16_t length)
+{
+        struct databuffer_basic_t *clone = NULL;
+        struct databuffer_basic_t *cloneEnd = NULL;
+        struct databuffer_basic_t *segment;
+        uint16_t segmentLength;
+        bool hasReference;
+
+        // jump to read-position
+        while ((chain != NULL) && (offset >= chain->length)) {
+                offset -= chain->length;
+                chain = chain->next;
+        }
+
+        while ((chain != NULL) && (length > 0)) {
+                segmentLength = min((uint16_t)(chain->length - offset), length);
+
+                segment = databuffer_allocSegment();
+                if (segment == NULL) {
+                        databuffer_free(clone);
+                        return NULL;
+                }
+
+                databuffer_create(segment, chain->data + offset, segmentLength);
+                segment->flags = chain->flags;
+
+                // take a reference to the shared Data-Block
+                if (chain->block != NULL) {
+                        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                                hasReference = chain->block->refCount < UINT8_MAX;
+                                if (hasReference)
+                                        chain->block->refCount++;
+                        }
+                        if (!hasReference) {
+                                mempool_free(&segmentPool, segment);
+                                databuffer_free(clone);
+                                return NULL;
+                        }
+                        segment->block = chain->block;
+                }
+
+                // append the new segment to the clone
+                if (cloneEnd == NULL) {
+                        clone = segment;
+                } else {
+                        cloneEnd->next = segment;
+                        SETPREV(segment, cloneEnd);
+                }
+                cloneEnd = segment;
+
+                length -= segmentLength;
+                offset = 0;
+                chain = chain->next;
+        }
+
+        if (clone != NULL)
+                databuffer_adjustLength(clone);
+
+        return clone;
+}
+
+void databuffer_getPoolStatistics(enum databuffer_pool_e pool,
+                                  struct mempool_statistics_t *statistics)
+{
+        switch (pool) {
+        case DATABUFFER_POOL_SEGMENT:
+                mempool_getStatistics(&segmentPool, statistics);
+                break;
+        case DATABUFFER_POOL_SMALLBLOCK:
+                mempool_getStatistics(&smallBlockPool, statistics);
+                break;
+        case DATABUFFER_POOL_LARGEBLOCK:
+                mempool_getStatistics(&largeBlockPool, statistics);
+                break;
+        }
+}
+
+uint8_t *databuffer_linearize(struct databuffer_basic_t *chain,
+                              uint16_t length,
+                              uint8_t *buffer)
+{
+        struct databuffer_cursor_t cursor;
+
+        if ((chain == NULL) || (databuffer_getTotalLength(chain) < length))
+                return NULL;
+
+        // fast path: the first segment already holds the requested Bytes
+        if ((chain->length >= length) && !databuffer_isProgmem(chain)) {
+                ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                        chainStatistics.linearizeDirect++;
+                }
+                return chain->data;
+        }
+
+        databuffer_cursor_init(&cursor, chain, 0);
+        databuffer_cursor_read(&cursor, buffer, length);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                chainStatistics.linearizeCopies++;
+                chainStatistics.linearizeCopiedBytes += length;
+        }
+
+        return buffer;
+}
+
+bool databuffer_coalesce(struct databuffer_basic_t *chain)
+{
+        struct databuffer_basic_t *first = chain;
+        struct databuffer_basic_t *last;
+        struct databuffer_basic_t *segment;
+        struct databuffer_basic_t *next;
+        struct databuffer_block_t *block;
+        uint8_t *data;
+        uint16_t runLength;
+        uint8_t mergedSegments = 0;
+        bool success = true;
+
+        while (first != NULL) {
+                // collect a run of adjacent small segments that fits into a
+                // single Data-Block, data in the program-memory stays there
+                runLength = first->length;
+                last = first;
+                if ((first->length < DATABUFFER_COALESCE_THRESHOLD) &&
+                    !databuffer_isProgmem(first)) {
+                        while ((last->next != NULL) &&
+                               (last->next->length < DATABUFFER_COALESCE_THRESHOLD) &&
+                               !databuffer_isProgmem(last->next) &&
+                               (runLength + last->next->length <=
+                                DATABUFFER_POOL_LARGEBLOCK_SIZE)) {
+                                last = last->next;
+                                runLength += last->length;
+                        }
+                }
+
+                if (last == first) {
+                        first = first->next;
+                        continue;
+                }
+
+                block = allocBlock(runLength);
+                if (block == NULL) {
+                        success = false;
+                        break;
+                }
+
+                // copy the run into the new Data-Block
+                data = block->data;
+                segment = first;
+                next = last->next;
+                while (segment != next) {
+                        memcpy(data, segment->data, segment->length);
+                        data += segment->length;
+                        segment = segment->next;
+                }
+
+                // the first element takes over the new Data-Block, the other
+                // elements of the run are released
+                segment = first->next;
+                while (segment != next) {
+                        last = segment->next;
+                        segment->next = NULL;
+                        databuffer_free(segment);
+                        mergedSegments++;
+                        segment = last;
+                }
+
+                if (first->block != NULL)
+                        releaseBlock(first->block);
+                first->block = block;
+                first->data = block->data;
+                first->length = runLength;
+                first->next = next;
+                if (next != NULL)
+                        SETPREV(next, first);
+
+                first = next;
+        }
+
+        if (chain != NULL)
+                databuffer_adjustLength(chain);
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                chainStatistics.coalesceCalls++;
+                chainStatistics.coalescedSegments += mergedSegments;
+                if (!success)
+                        chainStatistics.coalesceFailures++;
+        }
+
+        return success;
+}
+
+void databuffer_getStatistics(struct databuffer_statistics_t *statistics)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                *statistics = chainStatistics;
+        }
+}
+
+void databuffer_resetStatistics(void)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                memset(&chainStatistics, 0, sizeof(chainStatistics));
+        }
+}
 
 void databuffer_insertAtEnd(struct databuffer_basic_t* chain,
                             struct databuffer_basic_t* newSegment)
@@ -59,7 +481,7 @@ void databuffer_insertAtEnd(struct databuffer_basic_t* chain,
                 chainEnd = chainEnd->next;
         
         chainEnd->next = newSegment;
-        newSegment->prev = chainEnd;
+        SETPREV(newSegment, chainEnd);
         
         databuffer_adjustLength(chain);
 }
@@ -67,27 +489,31 @@ void databuffer_insertAtEnd(struct databuffer_basic_t* chain,
 void databuffer_insertAtStart(struct databuffer_basic_t* chain,
                               struct databuffer_basic_t* newSegment)
 {
-        struct databuffer_basic_t *chainHead = chain;
         struct databuffer_basic_t *newSegmentEnd = newSegment;
         
-        while (chainHead->prev != NULL)
-                chainHead = chainHead->prev;
         while (newSegmentEnd->next != NULL)
                 newSegmentEnd = newSegmentEnd->next;
         
-        newSegmentEnd->next = chainHead;
-        chainHead->prev = newSegmentEnd;
+        newSegmentEnd->next = chain;
+        SETPREV(chain, newSegmentEnd);
         
-        databuffer_adjustLength(chain);
+        databuffer_adjustLength(newSegment);
 }
 
-void databuffer_insertBefore(struct databuffer_basic_t* currentSegment,
+void databuffer_insertBefore(struct databuffer_basic_t* chain,
+                             struct databuffer_basic_t* currentSegment,
                              struct databuffer_basic_t* newSegment)
 {
-        if (currentSegment->prev == NULL) {
-                databuffer_insertAtStart(currentSegment, newSegment);
+        struct databuffer_basic_t *previousSegment = chain;
+        
+        if (currentSegment == chain) {
+                databuffer_insertAtStart(chain, newSegment);
         } else {
-                databuffer_insertAfter(currentSegment->prev, newSegment);
+                // search the predecessor from the start of the chain
+                while (previousSegment->next != currentSegment)
+                        previousSegment = previousSegment->next;
+                
+                databuffer_insertAfter(previousSegment, newSegment);
         }
 }
 
@@ -103,14 +529,27 @@ void databuffer_insertAfter(struct databuffer_basic_t* currentSegment,
                         newSegmentEnd = newSegmentEnd->next;
                 
                 newSegmentEnd->next = currentSegment->next;
-                newSegment->prev = currentSegment;
-                currentSegment->next->prev = newSegmentEnd;
+                SETPREV(newSegment, currentSegment);
+                SETPREV(currentSegment->next, newSegmentEnd);
                 currentSegment->next = newSegment;
         
                 databuffer_adjustLength(currentSegment);
         }
 }
 
+#ifdef DATABUFFER_COMPACT
+uint16_t databuffer_getTotalLength(struct databuffer_basic_t *chain)
+{
+        uint16_t totalLength = 0;
+        
+        while (chain != NULL) {
+                totalLength += chain->length;
+                chain = chain->next;
+        }
+        
+        return totalLength;
+}
+#else
 void databuffer_adjustLength(struct databuffer_basic_t* chain)
 {
         // go to end of the list
@@ -131,6 +570,7 @@ void databuffer_adjustLength(struct databuffer_basic_t* chain)
                 chainPosition = chainPosition->prev;
         }
 }
+#endif /* DATABUFFER_COMPACT */
 
 void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
                              uint16_t offsetDest,
@@ -138,16 +578,21 @@ void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
                              uint16_t offsetSrc,
                              uint16_t length)
 {
+        uint16_t totalLengthDest;
+        uint16_t totalLengthSrc;
+
         if ((chainDest == NULL) || (chainSrc == NULL))
                 return;
                 
-        if ((offsetDest >= chainDest->tot_length) ||
-            (offsetSrc >= chainSrc->tot_length))
+        totalLengthDest = databuffer_getTotalLength(chainDest);
+        totalLengthSrc = databuffer_getTotalLength(chainSrc);
+        if ((offsetDest >= totalLengthDest) ||
+            (offsetSrc >= totalLengthSrc))
                 return;
 
         // limit amount of bytes to copy
-        length = min(chainDest->tot_length - offsetDest, length);
-        length = min(chainSrc->tot_length - offsetSrc, length);
+        length = min((uint16_t)(totalLengthDest - offsetDest), length);
+        length = min((uint16_t)(totalLengthSrc - offsetSrc), length);
 
         // jump to read-position in destination and source
         while ((chainDest != NULL) && (offsetDest >= chainDest->length)) {
@@ -161,7 +606,8 @@ void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
 
         // copy
         while ((chainDest != NULL) && (chainSrc != NULL) && (length--)) {
-                chainDest->data[offsetDest++] = chainSrc->data[offsetSrc++];
+                chainDest->data[offsetDest++] =
+                        databuffer_readByte(chainSrc, offsetSrc++);
                 if (offsetDest >= chainDest->length) {
                         offsetDest -= chainDest->length;
                         chainDest = chainDest->next;
@@ -172,4 +618,385 @@ void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
                 }
         }
 }
+
+void databuffer_cursor_init(struct databuffer_cursor_t *cursor,
+                            struct databuffer_basic_t *chain,
+                            uint16_t offset)
+{
+        cursor->segment = chain;
+        cursor->offset = 0;
+        cursor->remaining = (chain != NULL) ? databuffer_getTotalLength(chain)
+                                            : 0;
+
+        advanceCursor(cursor, min(offset, cursor->remaining));
+}
+
+bool databuffer_cursor_skip(struct databuffer_cursor_t *cursor,
+                            uint16_t length)
+{
+        if (length > cursor->remaining)
+                return false;
+
+        advanceCursor(cursor, length);
+
+        return true;
+}
+
+bool databuffer_cursor_read(struct databuffer_cursor_t *cursor,
+                            uint8_t *buffer,
+                            uint16_t length)
+{
+        uint16_t chunkLength;
+
+        if (length > cursor->remaining)
+                return false;
+
+        while (length > 0) {
+                chunkLength = min((uint16_t)(cursor->segment->length
+                                             - cursor->offset),
+                                  length);
+                if (databuffer_isProgmem(cursor->segment))
+                        memcpy_P(buffer,
+                                 &cursor->segment->data[cursor->offset],
+                                 chunkLength);
+                else
+                        memcpy(buffer,
+                               &cursor->segment->data[cursor->offset],
+                               chunkLength);
+
+                buffer += chunkLength;
+                length -= chunkLength;
+                advanceCursor(cursor, chunkLength);
+        }
+
+        return true;
+}
+
+bool databuffer_cursor_write(struct databuffer_cursor_t *cursor,
+                             const uint8_t *buffer,
+                             uint16_t length)
+{
+        struct databuffer_basic_t *segment = cursor->segment;
+        uint16_t chunkLength;
+        uint16_t checkLength;
+
+        if (length > cursor->remaining)
+                return false;
+
+        // check all touched segments before anything is modified
+        checkLength = length + cursor->offset;
+        while ((segment != NULL) && (checkLength > 0)) {
+                if (!databuffer_isWritable(segment))
+                        return false;
+
+                checkLength -= min(segment->length, checkLength);
+                segment = segment->next;
+        }
+
+        while (length > 0) {
+                chunkLength = min((uint16_t)(cursor->segment->length
+                                             - cursor->offset),
+                                  length);
+                memcpy(&cursor->segment->data[cursor->offset],
+                       buffer,
+                       chunkLength);
+
+                buffer += chunkLength;
+                length -= chunkLength;
+                advanceCursor(cursor, chunkLength);
+        }
+
+        return true;
+}
+
+bool databuffer_cursor_readU8(struct databuffer_cursor_t *cursor,
+                              uint8_t *value)
+{
+        uint8_t *data = takeContiguous(cursor, 1, false);
+
+        // the Byte is in the program-memory or behind the end
+        if (data == NULL)
+                return databuffer_cursor_read(cursor, value, 1);
+
+        *value = data[0];
+
+        return true;
+}
+
+bool databuffer_cursor_readU16(struct databuffer_cursor_t *cursor,
+                               uint16_t *value)
+{
+        uint8_t buffer[2];
+        uint8_t *data = takeContiguous(cursor, 2, false);
+
+        // the field spans a segment boundary or is in the program-memory
+        if (data == NULL) {
+                if (!databuffer_cursor_read(cursor, buffer, 2))
+                        return false;
+                data = buffer;
+        }
+
+        *value = ((uint16_t)data[0] << 8) |
+                 ((uint16_t)data[1] << 0);
+
+        return true;
+}
+
+bool databuffer_cursor_readU32(struct databuffer_cursor_t *cursor,
+                               uint32_t *value)
+{
+        uint8_t buffer[4];
+        uint8_t *data = takeContiguous(cursor, 4, false);
+
+        // the field spans a segment boundary or is in the program-memory
+        if (data == NULL) {
+                if (!databuffer_cursor_read(cursor, buffer, 4))
+                        return false;
+                data = buffer;
+        }
+
+        *value = ((uint32_t)data[0] << 24) |
+                 ((uint32_t)data[1] << 16) |
+                 ((uint32_t)data[2] <<  8) |
+                 ((uint32_t)data[3] <<  0);
+
+        return true;
+}
+
+bool databuffer_cursor_writeU8(struct databuffer_cursor_t *cursor,
+                               uint8_t value)
+{
+        uint8_t *data = takeContiguous(cursor, 1, true);
+
+        if (data == NULL)
+                return false;
+
+        data[0] = value;
+
+        return true;
+}
+
+bool databuffer_cursor_writeU16(struct databuffer_cursor_t *cursor,
+                                uint16_t value)
+{
+        uint8_t buffer[2];
+        uint8_t *data;
+
+        buffer[0] = (uint8_t)((value >> 8) & 0x00FF);
+        buffer[1] = (uint8_t)((value >> 0) & 0x00FF);
+
+        data = takeContiguous(cursor, 2, true);
+        if (data == NULL)
+                return databuffer_cursor_write(cursor, buffer, 2);
+
+        data[0] = buffer[0];
+        data[1] = buffer[1];
+
+        return true;
+}
+
+bool databuffer_cursor_writeU32(struct databuffer_cursor_t *cursor,
+                                uint32_t value)
+{
+        uint8_t buffer[4];
+        uint8_t *data;
+
+        buffer[0] = (uint8_t)((value >> 24) & 0x000000FF);
+        buffer[1] = (uint8_t)((value >> 16) & 0x000000FF);
+        buffer[2] = (uint8_t)((value >>  8) & 0x000000FF);
+        buffer[3] = (uint8_t)((value >>  0) & 0x000000FF);
+
+        data = takeContiguous(cursor, 4, true);
+        if (data == NULL)
+                return databuffer_cursor_write(cursor, buffer, 4);
+
+        data[0] = buffer[0];
+        data[1] = buffer[1];
+        data[2] = buffer[2];
+        data[3] = buffer[3];
+
+        return true;
+}
+
+void databuffer_queue_init(struct databuffer_queue_t *queue,
+                           uint8_t maxPackets,
+                           uint16_t maxBytes,
+                           enum databuffer_queuePolicy_e policy)
+{
+        queue->head = 0;
+        queue->numberOfBytes = 0;
+        queue->maxBytes = maxBytes;
+        queue->numberOfPackets = 0;
+        queue->maxPackets = max(min(maxPackets,
+                                    (uint8_t)DATABUFFER_QUEUE_MAX_PACKETS),
+                                (uint8_t)1);
+        queue->policy = policy;
+        queue->drops = 0;
+}
+
+bool databuffer_queue_enqueue(struct databuffer_queue_t *queue,
+                              struct databuffer_basic_t *chain)
+{
+        struct databuffer_basic_t *dropped[DATABUFFER_QUEUE_MAX_PACKETS];
+        uint8_t numberOfDropped = 0;
+        uint8_t index;
+        uint16_t length = databuffer_getTotalLength(chain);
+        bool isQueued = false;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                // make room by dropping the oldest chains
+                if ((queue->policy == DATABUFFER_QUEUE_DROPHEAD) &&
+                    (length <= queue->maxBytes)) {
+                        while ((queue->numberOfPackets >= queue->maxPackets) ||
+                               (queue->numberOfBytes + length > queue->maxBytes)) {
+                                dropped[numberOfDropped] =
+                                        queue->packets[queue->head];
+                                queue->numberOfBytes -=
+                                        queue->lengths[queue->head];
+                                queue->head = queueIndex(queue, 1);
+                                queue->numberOfPackets--;
+                                queue->drops++;
+                                numberOfDropped++;
+                        }
+                }
+
+                if ((queue->numberOfPackets < queue->maxPackets) &&
+                    (queue->numberOfBytes + length <= queue->maxBytes)) {
+                        index = queueIndex(queue, queue->numberOfPackets);
+                        queue->packets[index] = chain;
+                        queue->lengths[index] = length;
+
+                        queue->numberOfBytes += length;
+                        queue->numberOfPackets++;
+                        isQueued = true;
+                } else {
+                        queue->drops++;
+                }
+        }
+
+        // release the dropped chains outside of the critical section
+        while (numberOfDropped > 0)
+                databuffer_free(dropped[--numberOfDropped]);
+        if (!isQueued)
+                databuffer_free(chain);
+
+        return isQueued;
+}
+
+struct databuffer_basic_t *databuffer_queue_dequeue(struct databuffer_queue_t *queue)
+{
+        struct databuffer_basic_t *chain = NULL;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                if (queue->numberOfPackets > 0) {
+                        chain = queue->packets[queue->head];
+                        queue->numberOfBytes -= queue->lengths[queue->head];
+                        queue->head = queueIndex(queue, 1);
+                        queue->numberOfPackets--;
+                }
+        }
+
+        return chain;
+}
+
+void databuffer_queue_flush(struct databuffer_queue_t *queue)
+{
+        struct databuffer_basic_t *chain;
+
+        while ((chain = databuffer_queue_dequeue(queue)) != NULL)
+                databuffer_free(chain);
+}
+
+uint16_t databuffer_queue_getByteCount(struct databuffer_queue_t *queue)
+{
+        uint16_t numberOfBytes;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                numberOfBytes = queue->numberOfBytes;
+        }
+
+        return numberOfBytes;
+}
+
+// private functions
+static struct databuffer_block_t *allocBlock(uint16_t size)
+{
+        struct databuffer_block_t *block = NULL;
+
+        // use the smallest block that fits, a large one if no small is left
+        if (size <= DATABUFFER_POOL_SMALLBLOCK_SIZE)
+                block = mempool_alloc(&smallBlockPool);
+        if ((block == NULL) && (size <= DATABUFFER_POOL_LARGEBLOCK_SIZE))
+                block = mempool_alloc(&largeBlockPool);
+
+        if (block != NULL)
+                block->refCount = 1;
+
+        return block;
+}
+
+static void releaseBlock(struct databuffer_block_t *block)
+{
+        uint8_t refCount;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                refCount = --block->refCount;
+        }
+
+        if (refCount == 0) {
+                if (mempool_contains(&smallBlockPool, block))
+                        mempool_free(&smallBlockPool, block);
+                else
+                        mempool_free(&largeBlockPool, block);
+        }
+}
+
+static void advanceCursor(struct databuffer_cursor_t *cursor, uint16_t length)
+{
+        cursor->remaining -= length;
+        length += cursor->offset;
+
+        // skip all segments that had been passed (and empty segments)
+        while ((cursor->segment != NULL) &&
+               (length >= cursor->segment->length)) {
+                length -= cursor->segment->length;
+                cursor->segment = cursor->segment->next;
+        }
+
+        cursor->offset = length;
+}
+
+static uint8_t *takeContiguous(struct databuffer_cursor_t *cursor,
+                               uint16_t length,
+                               bool writable)
+{
+        uint8_t *data;
+
+        // fast path: the field lies completely in the current segment
+        if ((cursor->remaining < length) ||
+            ((uint32_t)cursor->offset + length > cursor->segment->length) ||
+            databuffer_isProgmem(cursor->segment) ||
+            (writable && databuffer_isShared(cursor->segment)))
+                return NULL;
+
+        data = &cursor->segment->data[cursor->offset];
+
+        cursor->offset += length;
+        cursor->remaining -= length;
+        if (cursor->offset >= cursor->segment->length)
+                advanceCursor(cursor, 0);
+
+        return data;
+}
+
+static uint8_t queueIndex(struct databuffer_queue_t *queue, uint8_t offset)
+{
+        uint8_t index = queue->head + offset;
+
+        // the ring of the first DataBuffer-Elements wraps around
+        if (index >= DATABUFFER_QUEUE_MAX_PACKETS)
+                index -= DATABUFFER_QUEUE_MAX_PACKETS;
+
+        return index;
+}
 
@@ -1,11 +1,27 @@
 /**
  *******************************************************************************
  * @file        databuffer.h
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Header-file to handle chained databuffers.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added pools for DataBuffer-Elements and
+ *                         Data-Blocks. (MS)
+ *                      -# Added reference-counted Data-Blocks and
+ *                         databuffer_clone. (MS)
+ *                      -# Added headroom/tailroom-handling (push, pull, put
+ *                         and trim). (MS)
+ *                      -# Added cursor to access fields across segment
+ *                         boundaries. (MS)
+ *                      -# Added linearize and coalesce. (MS)
+ *                      -# Added the compact layout without backward links
+ *                         and total lengths (DATABUFFER_COMPACT). (MS)
+ *                      -# Added DataBuffer-Elements with Data-Arrays in the
+ *                         program-memory (DATABUFFER_FLAG_PROGMEM). (MS)
+ *                      -# Added databuffer_queue_t. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Changed from inline to macro. (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -49,30 +65,71 @@
 #define _DATABUFFER_H_
 
 #include "..\\system.h"
+#include "databuffer_cfg.h"
+#include "mempool.h"
+
+#include <avr/pgmspace.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ *  This enum specifies the pools of the DataBuffer-Module.
+ */
+enum databuffer_pool_e {
+        DATABUFFER_POOL_SEGMENT,                /* DataBuffer-Elements */
+        DATABUFFER_POOL_SMALLBLOCK,             /* small Data-Blocks */
+        DATABUFFER_POOL_LARGEBLOCK,             /* large Data-Blocks */
+};
+
+/**
+ *  Flag of a DataBuffer-Element: the Data-Array is located in the
+ *  program-memory (flash) and must be read with pgm_read_byte.
+ */
+#define DATABUFFER_FLAG_PROGMEM         (0x01)
+
+/**
+ *  This structure defines a Data-Block that had been taken from a pool.      @n
+ *  Several DataBuffer-Elements can share a Data-Block, it will be returned to
+ *  its pool when the last DataBuffer-Element referencing it had been freed.
+ */
+struct databuffer_block_t {
+        /**
+         * Number of DataBuffer-Elements that reference this Data-Block.
+         */
+        uint8_t                         refCount;
+
+        /**
+         * Data-Array.
+         */
+        uint8_t                         data[];
+};
+
 /**
  *  This structure defines a basic DataBuffer-Element.
  */
 struct databuffer_basic_t {
+#ifndef DATABUFFER_COMPACT
         /**
          * Pointer to the previous segment.
          */
         struct databuffer_basic_t      *prev;
         
+#endif /* DATABUFFER_COMPACT */
         /**
          * Pointer to the next segment.
          */
         struct databuffer_basic_t      *next;
         
+#ifndef DATABUFFER_COMPACT
         /**
          * Total length of the data beginning from this segment.
          */
         uint32_t                        tot_length;
         
+#endif /* DATABUFFER_COMPACT */
+        
         /**
          * Length of the data in this segment.
          */
@@ -82,8 +139,349 @@ struct databuffer_basic_t {
          * Pointer to the Data-Array.
          */
         uint8_t                        *data;
+
+        /**
+         * Pointer to the Data-Block (pool) that holds the Data-Array or NULL
+         * if the Data-Array is not owned by a pool.
+         */
+        struct databuffer_block_t      *block;
+
+        /**
+         * Flags of the DataBuffer-Element (see DATABUFFER_FLAG_*).
+         */
+        uint8_t                         flags;
+};
+
+/**
+ *  This enum specifies which packet is dropped if a queue is full.
+ */
+enum databuffer_queuePolicy_e {
+        DATABUFFER_QUEUE_DROPTAIL,              /* drop the new packet */
+        DATABUFFER_QUEUE_DROPHEAD,              /* drop the oldest packets */
+};
+
+/**
+ *  This structure defines a FIFO of DataBuffer-Chains. The first
+ *  DataBuffer-Elements of the chains and their lengths are held in a ring of
+ *  DATABUFFER_QUEUE_MAX_PACKETS entries, so the DataBuffer-Elements do not
+ *  need a link for the queue and no chain is walked in a critical section.
+ */
+struct databuffer_queue_t {
+        /**
+         * First DataBuffer-Elements of the queued chains.
+         */
+        struct databuffer_basic_t      *packets[DATABUFFER_QUEUE_MAX_PACKETS];
+
+        /**
+         * Number of Bytes of each chain in packets.
+         */
+        uint16_t                        lengths[DATABUFFER_QUEUE_MAX_PACKETS];
+
+        /**
+         * Index of the oldest chain in packets.
+         */
+        uint8_t                         head;
+
+        /**
+         * Number of Bytes of all queued chains.
+         */
+        uint16_t                        numberOfBytes;
+
+        /**
+         * Maximum number of Bytes of all queued chains.
+         */
+        uint16_t                        maxBytes;
+
+        /**
+         * Number of queued chains.
+         */
+        volatile uint8_t                numberOfPackets;
+
+        /**
+         * Maximum number of queued chains.
+         */
+        uint8_t                         maxPackets;
+
+        /**
+         * Policy if the limits would be exceeded.
+         */
+        enum databuffer_queuePolicy_e   policy;
+
+        /**
+         * Number of chains that had been dropped.
+         */
+        uint16_t                        drops;
 };
 
+#ifdef DATABUFFER_COMPACT
+/**
+ *  Returns the total length of the data beginning from a DataBuffer-Element.
+ *  The compact layout does not store the total length, the chain is walked.
+ *  @param      chain: DataBuffer-Element.
+ *  @return     Total length in Bytes (0 if chain is NULL).
+ *  @pre        None.
+ *  @post       None.
+ */
+uint16_t databuffer_getTotalLength(struct databuffer_basic_t *chain);
+#else
+/**
+ *  Returns the total length of the data beginning from a DataBuffer-Element.
+ *  @param      _chain_: DataBuffer-Element.
+ *  @return     Total length in Bytes.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_getTotalLength(_chain_)                              \
+        ((uint16_t)(_chain_)->tot_length)
+#endif /* DATABUFFER_COMPACT */
+
+/**
+ *  Initializes the pools of DataBuffer-Elements and Data-Blocks.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       All elements and blocks of the pools are free.
+ */
+void databuffer_init(void);
+
+/**
+ *  Takes a single DataBuffer-Element from the pool. The element does not have
+ *  a Data-Array, use databuffer_create to link one.                          @n
+ *  This function may be called from an interrupt service routine.
+ *  @return     Pointer to the DataBuffer-Element or NULL if the pool is empty.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       None.
+ */
+struct databuffer_basic_t *databuffer_allocSegment(void);
+
+/**
+ *  Takes a single DataBuffer-Element and a Data-Block from the pools. The
+ *  smallest Data-Block that can hold the requested number of Bytes will be
+ *  used.                                                                     @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      size: Number of Bytes the Data-Array must be able to hold.
+ *  @return     Pointer to the DataBuffer-Element or NULL if the pools are
+ *              empty or the size is too large.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The length of the DataBuffer-Element is set to size.
+ */
+struct databuffer_basic_t *databuffer_alloc(uint16_t size);
+
+/**
+ *  Takes a single DataBuffer-Element and a Data-Block from the pools and
+ *  reserves free space in front of the data. The DataBuffer-Element is empty,
+ *  the data can be appended with databuffer_put and the headers of the lower
+ *  layers can be prepended in place with databuffer_push.                    @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      headroom: Number of Bytes to reserve in front of the data.
+ *  @param      size: Number of Bytes that can be appended behind the
+ *              headroom.
+ *  @return     Pointer to the DataBuffer-Element or NULL if the pools are
+ *              empty or the size is too large.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The length of the DataBuffer-Element is 0.
+ */
+struct databuffer_basic_t *databuffer_allocWithHeadroom(uint16_t headroom,
+                                                        uint16_t size);
+
+/**
+ *  Returns the number of free Bytes in front of the data of a
+ *  DataBuffer-Element.
+ *  @param      _segment_: DataBuffer-Element.
+ *  @return     Number of free Bytes in front of the data (0 if the Data-Array
+ *              is not owned by a pool).
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_getHeadroom(_segment_)                               \
+        (((_segment_)->block != NULL)                                   \
+         ? (uint16_t)((_segment_)->data - (_segment_)->block->data) : 0)
+
+/**
+ *  Returns the number of free Bytes behind the data of a DataBuffer-Element.
+ *  @param      segment: DataBuffer-Element.
+ *  @return     Number of free Bytes behind the data (0 if the Data-Array is
+ *              not owned by a pool).
+ *  @pre        The function databuffer_init had been called.
+ *  @post       None.
+ */
+uint16_t databuffer_getTailroom(struct databuffer_basic_t *segment);
+
+/**
+ *  Prepends a number of Bytes in front of the data of a DataBuffer-Element by
+ *  using its headroom. The data is not moved.
+ *  @param      segment: DataBuffer-Element.
+ *  @param      length: Number of Bytes to prepend.
+ *  @return     Pointer to the first prepended Byte or NULL if the headroom is
+ *              too small or the Data-Block is shared.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The length of the DataBuffer-Element and the total length of
+ *              the DataBuffer-Chain had been increased.
+ */
+uint8_t *databuffer_push(struct databuffer_basic_t *segment, uint16_t length);
+
+/**
+ *  Removes a number of Bytes from the front of the data of a
+ *  DataBuffer-Element (e.g. a header that has been processed). The Bytes
+ *  become headroom again.
+ *  @param      segment: DataBuffer-Element.
+ *  @param      length: Number of Bytes to remove.
+ *  @return     Pointer to the new first Byte of the data or NULL if the
+ *              DataBuffer-Element holds less Bytes.
+ *  @pre        None.
+ *  @post       The length of the DataBuffer-Element and the total length of
+ *              the DataBuffer-Chain had been decreased.
+ */
+uint8_t *databuffer_pull(struct databuffer_basic_t *segment, uint16_t length);
+
+/**
+ *  Appends a number of Bytes behind the data of a DataBuffer-Element by using
+ *  its tailroom.
+ *  @param      segment: DataBuffer-Element.
+ *  @param      length: Number of Bytes to append.
+ *  @return     Pointer to the first appended Byte or NULL if the tailroom is
+ *              too small or the Data-Block is shared.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The length of the DataBuffer-Element and the total length of
+ *              the DataBuffer-Chain had been increased.
+ */
+uint8_t *databuffer_put(struct databuffer_basic_t *segment, uint16_t length);
+
+/**
+ *  Cuts the data of a DataBuffer-Element to a specific length. The removed
+ *  Bytes become tailroom again.
+ *  @param      segment: DataBuffer-Element.
+ *  @param      length: New length of the data. If the DataBuffer-Element
+ *              holds less Bytes nothing will be changed.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The length of the DataBuffer-Element and the total length of
+ *              the DataBuffer-Chain had been updated.
+ */
+void databuffer_trim(struct databuffer_basic_t *segment, uint16_t length);
+
+/**
+ *  Returns all DataBuffer-Elements of a DataBuffer-Chain that had been taken
+ *  from the pool and releases their references to the Data-Blocks. A
+ *  Data-Block is returned to its pool when its last reference had been
+ *  released. Elements and Data-Arrays that are not owned by a pool are left
+ *  untouched.                                                                @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      chain: First DataBuffer-Element of the chain. NULL will be
+ *              ignored.
+ *  @return     None.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The DataBuffer-Chain must not be used anymore.
+ */
+void databuffer_free(struct databuffer_basic_t *chain);
+
+/**
+ *  Creates a new DataBuffer-Chain that references a specific amount of data of
+ *  another DataBuffer-Chain beginning from the specified offset. The data will
+ *  not be copied, the Data-Blocks are shared and their reference-counters are
+ *  increased.                                                                @n
+ *  Data-Arrays that are not owned by a pool are shared as well, they must not
+ *  be modified or reused until all clones had been freed.                    @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      chain: First DataBuffer-Element of the chain to clone.
+ *  @param      offset: Offset in the chain in Bytes.
+ *  @param      length: Number of Bytes to clone.
+ *  @return     First DataBuffer-Element of the clone or NULL if the pool is
+ *              empty or there is no data in the specified range.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The clone must be released by databuffer_free.
+ */
+struct databuffer_basic_t *databuffer_clone_partial(struct databuffer_basic_t *chain,
+                                                    uint16_t offset,
+                                                    uint16_t length);
+
+/**
+ *  Creates a new DataBuffer-Chain that references all data of another
+ *  DataBuffer-Chain without copying it.
+ *  @param      _chain_: First DataBuffer-Element of the chain to clone.
+ *  @return     First DataBuffer-Element of the clone or NULL if the pool is
+ *              empty.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The clone must be released by databuffer_free.
+ *  @see        databuffer_clone_partial
+ */
+#define databuffer_clone(_chain_)                                       \
+        databuffer_clone_partial(_chain_, 0, databuffer_getTotalLength(_chain_))
+
+/**
+ *  Checks if the Data-Block of a DataBuffer-Element is referenced by other
+ *  DataBuffer-Elements as well. The data of a shared Data-Block must not be
+ *  modified.
+ *  @param      _segment_: DataBuffer-Element.
+ *  @return     True if the Data-Block is shared.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_isShared(_segment_)                                  \
+        (((_segment_)->block != NULL) && ((_segment_)->block->refCount > 1))
+
+/**
+ *  Checks if the Data-Array of a DataBuffer-Element is located in the
+ *  program-memory.
+ *  @param      _segment_: DataBuffer-Element.
+ *  @return     True if the Data-Array is located in the program-memory.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_isProgmem(_segment_)                                 \
+        (((_segment_)->flags & DATABUFFER_FLAG_PROGMEM) != 0)
+
+/**
+ *  Checks if the data of a DataBuffer-Element may be modified, i.e. the
+ *  Data-Block is not shared and the Data-Array is not located in the
+ *  program-memory.
+ *  @param      _segment_: DataBuffer-Element.
+ *  @return     True if the data may be modified.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_isWritable(_segment_)                                \
+        (!databuffer_isShared(_segment_) && !databuffer_isProgmem(_segment_))
+
+/**
+ *  Reads a single Byte of a DataBuffer-Element, regardless whether the
+ *  Data-Array is located in the RAM or in the program-memory.
+ *  @param      _segment_: DataBuffer-Element.
+ *  @param      _index_: Index of the Byte in the DataBuffer-Element.
+ *  @return     Value of the Byte.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_readByte(_segment_, _index_)                         \
+        (databuffer_isProgmem(_segment_)                                \
+         ? pgm_read_byte(&(_segment_)->data[_index_])                   \
+         : (_segment_)->data[_index_])
+
+/**
+ *  Takes a single DataBuffer-Element from the pool and links it to a
+ *  Data-Array in the program-memory. Constant data can be sent this way
+ *  without copying it into the RAM.                                          @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      data: Pointer to the Data-Array in the program-memory.
+ *  @param      length: Number of Bytes in the Data-Array.
+ *  @return     Pointer to the DataBuffer-Element or NULL if the pool is
+ *              empty.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The DataBuffer-Element must be released by databuffer_free.
+ */
+struct databuffer_basic_t *databuffer_allocP(const uint8_t *data,
+                                             uint16_t length);
+
+/**
+ *  Copies the statistics of one of the pools.
+ *  @param      pool: Pool.
+ *  @param      statistics: Buffer that will hold the statistics.
+ *  @return     None.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       None.
+ */
+void databuffer_getPoolStatistics(enum databuffer_pool_e pool,
+                                  struct mempool_statistics_t *statistics);
+
 /**
  *  Inserts a DataBuffer-Segment (it can also be a chain) at the end of another
  *  DataBuffer-Chain.
@@ -101,13 +499,14 @@ void databuffer_insertAtEnd(struct databuffer_basic_t* chain,
 /**
  *  Inserts a DataBuffer-Segment (it can also be a chain) at the start of
  *  another DataBuffer-Chain.
- *  @param      chain: DataBuffer-Chain.
+ *  @param      chain: First DataBuffer-Element of the chain.
  *  @param      newSegment: DataBuffer-Element(s) to insert at the start.
  *  @return     None.
  *  @pre        None.
  *  @post       The DataBuffer-Element(s) had been inserted at the start of the
  *              DataBuffer-Chain and the total length of the whole
- *              DataBuffer-Chain had been updated.
+ *              DataBuffer-Chain had been updated. newSegment is the first
+ *              DataBuffer-Element of the chain now.
  */
 void databuffer_insertAtStart(struct databuffer_basic_t* chain,
                               struct databuffer_basic_t* newSegment);
@@ -115,17 +514,21 @@ void databuffer_insertAtStart(struct databuffer_basic_t* chain,
 /**
  *  Inserts a DataBuffer-Segment (it can also be a chain) before another
  *  specified DataBuffer-Element. This Element can also be at any position in a
- *  DataBuffer-Chain.
+ *  DataBuffer-Chain. The predecessor is searched from the first element
+ *  because the elements may not be linked backwards (see
+ *  DATABUFFER_COMPACT).
+ *  @param      chain: First DataBuffer-Element of the chain.
  *  @param      currentSegment: DataBuffer-Element.
  *  @param      newSegment: DataBuffer-Element(s) to insert at before the
  *              specified DataBuffer-Element.
  *  @return     None.
- *  @pre        None.
+ *  @pre        currentSegment is an element of chain.
  *  @post       The DataBuffer-Element(s) had been inserted before the specified
  *              DataBuffer-Element and the total length of the whole
  *              DataBuffer-Chain had been updated.
  */
-void databuffer_insertBefore(struct databuffer_basic_t* currentSegment,
+void databuffer_insertBefore(struct databuffer_basic_t* chain,
+                             struct databuffer_basic_t* currentSegment,
                              struct databuffer_basic_t* newSegment);
 
 /**
@@ -160,14 +563,38 @@ inline void databuffer_create(struct databuffer_basic_t *databuffer,
                               uint16_t length)
 {
         if (databuffer != NULL) {
+#ifndef DATABUFFER_COMPACT
                 databuffer->prev = NULL;
-                databuffer->next = NULL;
                 databuffer->tot_length = length;
+#endif /* DATABUFFER_COMPACT */
+                databuffer->next = NULL;
                 databuffer->length = length;
                 databuffer->data = data;
+                databuffer->block = NULL;
+                databuffer->flags = 0;
         }
 }
 
+/**
+ *  Creates a new single DataBuffer-Element that is linked to a Data-Array in
+ *  the program-memory.
+ *  @param      databuffer: DataBuffer-Element.
+ *  @param      data: Pointer to a Data-Array in the program-memory.
+ *  @param      length: Number of Bytes in the Data-Array.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The DataBuffer-Element has been created, its data must not
+ *              be modified.
+ */
+inline void databuffer_createP(struct databuffer_basic_t *databuffer,
+                               const uint8_t *data,
+                               uint16_t length)
+{
+        databuffer_create(databuffer, (uint8_t *)data, length);
+        if (databuffer != NULL)
+                databuffer->flags = DATABUFFER_FLAG_PROGMEM;
+}
+
 /**
  *  Copies a specific amount of data from one DataBuffer-Chain to another
  *  beginning from the specified offsets in each DataBuffer-Chain.
@@ -176,10 +603,12 @@ inline void databuffer_create(struct databuffer_basic_t *databuffer,
  *  @param      offsetDest: Offset in the Destination-Chain in Bytes.
  *  @param      chainSrc: First DataBuffer-Element of a chain that holds the
  *              data that has to be copied.
- *  @param      offsetSrc: Offset in the Source-Chain in Bytes.
+ *  @param      offsetSrc: Offset in the Source-Chain in Bytes. The
+ *              Source-Chain may contain Data-Arrays in the program-memory.
  *  @param      length: Number of Bytes to copy.
  *  @return     None.
- *  @pre        None.
+ *  @pre        The Data-Arrays of the Destination-Chain are located in the
+ *              RAM.
  *  @post       The data has been copied from the source to the destination.
  */
 void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
@@ -204,6 +633,345 @@ void databuffer_copy_partial(struct databuffer_basic_t* chainDest,
 #define databuffer_copy(_chainDest_, _chainSrc_, _length_)      \
         databuffer_copy_partial(_chainDest_, 0, _chainSrc_, 0, _length_)
 
+/**
+ *  This structure holds the statistics of the linearize- and
+ *  coalesce-operations.
+ */
+struct databuffer_statistics_t {
+        /**
+         * Number of linearizations that returned the data in place.
+         */
+        uint16_t                        linearizeDirect;
+
+        /**
+         * Number of linearizations that had to copy the data.
+         */
+        uint16_t                        linearizeCopies;
+
+        /**
+         * Number of Bytes copied by linearizations.
+         */
+        uint32_t                        linearizeCopiedBytes;
+
+        /**
+         * Number of calls of databuffer_coalesce.
+         */
+        uint16_t                        coalesceCalls;
+
+        /**
+         * Number of segments that had been merged into their predecessor.
+         */
+        uint16_t                        coalescedSegments;
+
+        /**
+         * Number of coalesce-operations that stopped early because the
+         * pools were empty.
+         */
+        uint16_t                        coalesceFailures;
+};
+
+/**
+ *  Provides the first Bytes of a DataBuffer-Chain as a contiguous array. If
+ *  the first segment holds all requested Bytes a pointer into the segment is
+ *  returned, otherwise the Bytes are copied into the buffer.
+ *  @param      chain: First DataBuffer-Element of the chain.
+ *  @param      length: Number of Bytes that must be contiguous.
+ *  @param      buffer: Buffer of at least length Bytes that is used if the
+ *              Bytes have to be copied.
+ *  @return     Pointer to the contiguous Bytes (must be treated as read-only)
+ *              or NULL if the chain holds less Bytes.
+ *  @pre        None.
+ *  @post       The statistics had been updated.
+ */
+uint8_t *databuffer_linearize(struct databuffer_basic_t *chain,
+                              uint16_t length,
+                              uint8_t *buffer);
+
+/**
+ *  Merges runs of adjacent segments that are shorter than
+ *  DATABUFFER_COALESCE_THRESHOLD into new Data-Blocks. The first element of a
+ *  run is kept and takes over the new Data-Block, the other elements are
+ *  released. Elements that are not owned by a pool are unlinked but not
+ *  modified.                                                                 @n
+ *  This function should not be called from an interrupt service routine
+ *  because it copies the data.
+ *  @param      chain: First DataBuffer-Element of the chain.
+ *  @return     False if the pools were empty, the chain is valid but may only
+ *              be partly coalesced in this case.
+ *  @pre        The function databuffer_init had been called.
+ *  @post       The chain must be released by databuffer_free.
+ */
+bool databuffer_coalesce(struct databuffer_basic_t *chain);
+
+/**
+ *  Copies the statistics of the linearize- and coalesce-operations.
+ *  @param      statistics: Buffer that will hold the statistics.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       None.
+ */
+void databuffer_getStatistics(struct databuffer_statistics_t *statistics);
+
+/**
+ *  Resets the statistics of the linearize- and coalesce-operations.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       All counters are 0.
+ */
+void databuffer_resetStatistics(void);
+
+/**
+ *  This structure defines a cursor that reads or writes the data of a
+ *  DataBuffer-Chain sequentially. Fields in network byte order (big-endian)
+ *  can be accessed even if they span the boundary of two segments.
+ */
+struct databuffer_cursor_t {
+        /**
+         * Pointer to the segment that holds the next Byte.
+         */
+        struct databuffer_basic_t      *segment;
+
+        /**
+         * Offset of the next Byte in the current segment.
+         */
+        uint16_t                        offset;
+
+        /**
+         * Number of Bytes from the cursor to the end of the chain.
+         */
+        uint16_t                        remaining;
+};
+
+/**
+ *  Places a cursor at a specific offset of a DataBuffer-Chain.
+ *  @param      cursor: Cursor to initialize.
+ *  @param      chain: First DataBuffer-Element of the chain.
+ *  @param      offset: Offset in the chain in Bytes. If the chain holds less
+ *              Bytes the cursor is placed at its end.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The cursor can be used to access the data of the chain.
+ */
+void databuffer_cursor_init(struct databuffer_cursor_t *cursor,
+                            struct databuffer_basic_t *chain,
+                            uint16_t offset);
+
+/**
+ *  Returns the number of Bytes from the cursor to the end of the chain.
+ *  @param      _cursor_: Pointer to the cursor.
+ *  @return     Number of remaining Bytes.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+#define databuffer_cursor_getRemaining(_cursor_)                        \
+        ((_cursor_)->remaining)
+
+/**
+ *  Moves a cursor forward without accessing the data.
+ *  @param      cursor: Cursor.
+ *  @param      length: Number of Bytes to skip.
+ *  @return     False if the chain holds less Bytes, the cursor is not moved
+ *              in this case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_skip(struct databuffer_cursor_t *cursor,
+                            uint16_t length);
+
+/**
+ *  Copies a number of Bytes from the chain into a buffer and moves the cursor
+ *  behind them.
+ *  @param      cursor: Cursor.
+ *  @param      buffer: Buffer that will hold the Bytes.
+ *  @param      length: Number of Bytes to read.
+ *  @return     False if the chain holds less Bytes, the cursor is not moved
+ *              in this case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_read(struct databuffer_cursor_t *cursor,
+                            uint8_t *buffer,
+                            uint16_t length);
+
+/**
+ *  Copies a number of Bytes from a buffer into the chain and moves the cursor
+ *  behind them.
+ *  @param      cursor: Cursor.
+ *  @param      buffer: Buffer that holds the Bytes.
+ *  @param      length: Number of Bytes to write.
+ *  @return     False if the chain holds less Bytes or one of the touched
+ *              Data-Blocks is shared, the cursor is not moved in this case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_write(struct databuffer_cursor_t *cursor,
+                             const uint8_t *buffer,
+                             uint16_t length);
+
+/**
+ *  Reads a single Byte and moves the cursor behind it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Buffer that will hold the value.
+ *  @return     False if the cursor is at the end of the chain.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_readU8(struct databuffer_cursor_t *cursor,
+                              uint8_t *value);
+
+/**
+ *  Reads a 16-Bit-Value in network byte order and moves the cursor behind it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Buffer that will hold the value.
+ *  @return     False if the chain holds less than 2 Bytes, the cursor is not
+ *              moved in this case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_readU16(struct databuffer_cursor_t *cursor,
+                               uint16_t *value);
+
+/**
+ *  Reads a 32-Bit-Value in network byte order and moves the cursor behind it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Buffer that will hold the value.
+ *  @return     False if the chain holds less than 4 Bytes, the cursor is not
+ *              moved in this case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_readU32(struct databuffer_cursor_t *cursor,
+                               uint32_t *value);
+
+/**
+ *  Writes a single Byte and moves the cursor behind it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Value to write.
+ *  @return     False if the cursor is at the end of the chain or the
+ *              Data-Block is shared.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_writeU8(struct databuffer_cursor_t *cursor,
+                               uint8_t value);
+
+/**
+ *  Writes a 16-Bit-Value in network byte order and moves the cursor behind
+ *  it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Value to write.
+ *  @return     False if the chain holds less than 2 Bytes or one of the
+ *              touched Data-Blocks is shared, the cursor is not moved in this
+ *              case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_writeU16(struct databuffer_cursor_t *cursor,
+                                uint16_t value);
+
+/**
+ *  Writes a 32-Bit-Value in network byte order and moves the cursor behind
+ *  it.
+ *  @param      cursor: Cursor.
+ *  @param      value: Value to write.
+ *  @return     False if the chain holds less than 4 Bytes or one of the
+ *              touched Data-Blocks is shared, the cursor is not moved in this
+ *              case.
+ *  @pre        The function databuffer_cursor_init had been called.
+ *  @post       None.
+ */
+bool databuffer_cursor_writeU32(struct databuffer_cursor_t *cursor,
+                                uint32_t value);
+
+/**
+ *  Initializes an empty queue.
+ *  @param      queue: Queue to initialize.
+ *  @param      maxPackets: Maximum number of queued chains, it is limited to
+ *                          [1, DATABUFFER_QUEUE_MAX_PACKETS].
+ *  @param      maxBytes: Maximum number of Bytes of all queued chains.
+ *  @param      policy: Chain to drop if a limit would be exceeded.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The queue is empty and the drop-counter is 0.
+ */
+void databuffer_queue_init(struct databuffer_queue_t *queue,
+                           uint8_t maxPackets,
+                           uint16_t maxBytes,
+                           enum databuffer_queuePolicy_e policy);
+
+/**
+ *  Appends a DataBuffer-Chain at the end of a queue in constant time. The
+ *  queue takes the ownership of the chain, dropped chains are freed.         @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      queue: Queue.
+ *  @param      chain: First DataBuffer-Element of the chain.
+ *  @return     False if the chain itself had been dropped.
+ *  @pre        The chain is not part of another queue.
+ *  @post       The drop-counter had been increased for every dropped chain.
+ */
+bool databuffer_queue_enqueue(struct databuffer_queue_t *queue,
+                              struct databuffer_basic_t *chain);
+
+/**
+ *  Removes the oldest DataBuffer-Chain from a queue in constant time.        @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      queue: Queue.
+ *  @return     First DataBuffer-Element of the chain or NULL if the queue is
+ *              empty.
+ *  @pre        None.
+ *  @post       The caller owns the chain and must release it by
+ *              databuffer_free.
+ */
+struct databuffer_basic_t *databuffer_queue_dequeue(struct databuffer_queue_t *queue);
+
+/**
+ *  Frees all DataBuffer-Chains of a queue.
+ *  @param      queue: Queue.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The queue is empty.
+ */
+void databuffer_queue_flush(struct databuffer_queue_t *queue);
+
+/**
+ *  Returns the number of Bytes of all queued chains.
+ *  @param      queue: Queue.
+ *  @return     Number of Bytes.
+ *  @pre        None.
+ *  @post       None.
+ */
+uint16_t databuffer_queue_getByteCount(struct databuffer_queue_t *queue);
+
+/**
+ *  Returns the number of queued chains.
+ *  @param      _queue_: Pointer to the queue.
+ *  @return     Number of chains.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_queue_getPacketCount(_queue_)                        \
+        ((_queue_)->numberOfPackets)
+
+/**
+ *  Checks if a queue is empty.
+ *  @param      _queue_: Pointer to the queue.
+ *  @return     True if there is no chain in the queue.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_queue_isEmpty(_queue_)                               \
+        ((_queue_)->numberOfPackets == 0)
+
+/**
+ *  Returns the number of chains that had been dropped.
+ *  @param      _queue_: Pointer to the queue.
+ *  @return     Number of dropped chains.
+ *  @pre        None.
+ *  @post       None.
+ */
+#define databuffer_queue_getDropCount(_queue_)                          \
+        ((_queue_)->drops)
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -0,0 +1,307 @@
+/**
+ *******************************************************************************
+ * @file        databuffer.hpp
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-only C++-wrappers of the DataBuffer-Module.
+ *              DataBufferChain owns a DataBuffer-Chain and returns it to the
+ *              pools when it goes out of scope, it can be moved but not
+ *              copied. DataBufferView is a non-owning view of contiguous
+ *              data with accessors for fields in network byte order.
+ *              All functions are inline and only forward to the C-API.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _DATABUFFER_HPP_
+#define _DATABUFFER_HPP_
+
+#ifndef __cplusplus
+        #error "databuffer.hpp can only be used by C++"
+#endif
+
+#include "databuffer.h"
+
+/**
+ *  Non-owning view of contiguous data in the RAM.
+ */
+class DataBufferView {
+public:
+        /**
+         *  Creates an empty view.
+         */
+        constexpr DataBufferView() : data_(nullptr), length_(0) {}
+
+        /**
+         *  Creates a view of an array.
+         *  @param      data: Pointer to the first Byte.
+         *  @param      length: Number of Bytes.
+         */
+        constexpr DataBufferView(const uint8_t *data, uint16_t length)
+                : data_(data), length_(length) {}
+
+        /**
+         *  Creates a view of the data of a single DataBuffer-Element.
+         *  @param      segment: DataBuffer-Element or NULL.
+         *  @pre        The data of the DataBuffer-Element is not located in
+         *              the program-memory.
+         */
+        explicit DataBufferView(const struct databuffer_basic_t *segment)
+                : data_(segment != NULL ? segment->data : nullptr),
+                  length_(segment != NULL ? segment->length : 0) {}
+
+        /**
+         *  Returns the pointer to the first Byte.
+         */
+        constexpr const uint8_t *data() const { return data_; }
+
+        /**
+         *  Returns the number of Bytes.
+         */
+        constexpr uint16_t length() const { return length_; }
+
+        /**
+         *  Checks if the view holds no data.
+         */
+        constexpr bool isEmpty() const { return length_ == 0; }
+
+        /**
+         *  Returns the Byte at a specific offset.
+         *  @pre        offset is less than length().
+         */
+        constexpr uint8_t operator[](uint16_t offset) const
+        {
+                return data_[offset];
+        }
+
+        /**
+         *  Reads an 8-Bit-Value.
+         *  @pre        offset + 1 is less or equal to length().
+         */
+        constexpr uint8_t readU8(uint16_t offset) const
+        {
+                return data_[offset];
+        }
+
+        /**
+         *  Reads a 16-Bit-Value in network byte order.
+         *  @pre        offset + 2 is less or equal to length().
+         */
+        constexpr uint16_t readU16(uint16_t offset) const
+        {
+                return ((uint16_t)data_[offset] << 8) |
+                       ((uint16_t)data_[offset + 1]);
+        }
+
+        /**
+         *  Reads a 32-Bit-Value in network byte order.
+         *  @pre        offset + 4 is less or equal to length().
+         */
+        constexpr uint32_t readU32(uint16_t offset) const
+        {
+                return ((uint32_t)readU16(offset) << 16) |
+                       ((uint32_t)readU16(offset + 2));
+        }
+
+        /**
+         *  Checks if a field fits into the view.
+         *  @param      offset: Offset of the field.
+         *  @param      length: Length of the field.
+         */
+        constexpr bool contains(uint16_t offset, uint16_t length) const
+        {
+                return (offset <= length_) && (length <= length_ - offset);
+        }
+
+        /**
+         *  Returns a view of a part of this view. The part is truncated at
+         *  the end of this view.
+         *  @param      offset: Offset of the part.
+         *  @param      length: Length of the part.
+         */
+        constexpr DataBufferView subView(uint16_t offset, uint16_t length) const
+        {
+                return offset >= length_ ?
+                        DataBufferView(data_ + length_, 0) :
+                        DataBufferView(data_ + offset,
+                                       length < length_ - offset ?
+                                               length : length_ - offset);
+        }
+
+private:
+        const uint8_t *data_;
+        uint16_t length_;
+};
+
+/**
+ *  Owner of a DataBuffer-Chain. The chain is released by databuffer_free
+ *  when the owner is destroyed or reset. The ownership can only be moved.
+ */
+class DataBufferChain {
+public:
+        /**
+         *  Creates an owner without a chain.
+         */
+        constexpr DataBufferChain() : chain_(nullptr) {}
+
+        /**
+         *  Takes the ownership of a chain.
+         *  @param      chain: First DataBuffer-Element of the chain or NULL.
+         */
+        explicit constexpr DataBufferChain(struct databuffer_basic_t *chain)
+                : chain_(chain) {}
+
+        DataBufferChain(const DataBufferChain &) = delete;
+        DataBufferChain &operator=(const DataBufferChain &) = delete;
+
+        /**
+         *  Moves the ownership from another owner, which is empty afterwards.
+         */
+        DataBufferChain(DataBufferChain &&other) : chain_(other.release()) {}
+
+        /**
+         *  Releases the own chain and moves the ownership from another owner.
+         */
+        DataBufferChain &operator=(DataBufferChain &&other)
+        {
+                if (this != &other)
+                        reset(other.release());
+                return *this;
+        }
+
+        ~DataBufferChain() { databuffer_free(chain_); }
+
+        /**
+         *  Allocates a chain with a single DataBuffer-Element.
+         *  @param      size: Number of Bytes (see databuffer_alloc).
+         *  @return     The owner, it is empty if the pools are exhausted.
+         */
+        static DataBufferChain alloc(uint16_t size)
+        {
+                return DataBufferChain(databuffer_alloc(size));
+        }
+
+        /**
+         *  Allocates a chain with reserved room in front of the data.
+         *  @param      headroom: Number of Bytes in front of the data.
+         *  @param      size: Number of Bytes behind the data.
+         *  @return     The owner, it is empty if the pools are exhausted.
+         */
+        static DataBufferChain allocWithHeadroom(uint16_t headroom,
+                                                 uint16_t size)
+        {
+                return DataBufferChain(databuffer_allocWithHeadroom(headroom,
+                                                                    size));
+        }
+
+        /**
+         *  Returns the chain, the ownership is not changed.
+         */
+        constexpr struct databuffer_basic_t *get() const { return chain_; }
+
+        /**
+         *  Returns the chain and gives up the ownership, e.g. to pass it
+         *  to net_PPP_txDataBuffer.
+         */
+        struct databuffer_basic_t *release()
+        {
+                struct databuffer_basic_t *chain = chain_;
+
+                chain_ = nullptr;
+                return chain;
+        }
+
+        /**
+         *  Releases the own chain and takes the ownership of another one.
+         *  @param      chain: First DataBuffer-Element of the chain or NULL.
+         */
+        void reset(struct databuffer_basic_t *chain = nullptr)
+        {
+                struct databuffer_basic_t *old = chain_;
+
+                chain_ = chain;
+                databuffer_free(old);
+        }
+
+        /**
+         *  Checks if a chain is owned.
+         */
+        constexpr explicit operator bool() const { return chain_ != nullptr; }
+
+        /**
+         *  Returns the number of Bytes of the chain.
+         */
+        uint16_t totalLength() const
+        {
+                return chain_ != nullptr ? databuffer_getTotalLength(chain_) : 0;
+        }
+
+        /**
+         *  Returns a view of the data of the first DataBuffer-Element.
+         *  @pre        The data is not located in the program-memory.
+         */
+        DataBufferView firstSegment() const { return DataBufferView(chain_); }
+
+        /**
+         *  Returns a view of the first Bytes of the chain. The data is copied
+         *  to buffer if it spans several DataBuffer-Elements.
+         *  @param      length: Number of Bytes.
+         *  @param      buffer: Buffer of at least length Bytes.
+         *  @return     The view, it is empty if the chain is too short.
+         */
+        DataBufferView linearize(uint16_t length, uint8_t *buffer) const
+        {
+                const uint8_t *data = databuffer_linearize(chain_, length, buffer);
+
+                return data != NULL ? DataBufferView(data, length) :
+                                      DataBufferView();
+        }
+
+        /**
+         *  Creates a new owner of a part of the chain, the data is shared.
+         *  @param      offset: Offset of the part.
+         *  @param      length: Length of the part.
+         *  @return     The owner, it is empty if the pools are exhausted.
+         */
+        DataBufferChain clone(uint16_t offset, uint16_t length) const
+        {
+                return DataBufferChain(databuffer_clone_partial(chain_,
+                                                                offset,
+                                                                length));
+        }
+
+private:
+        struct databuffer_basic_t *chain_;
+};
+
+#endif /* _DATABUFFER_HPP_ */
@@ -0,0 +1,97 @@
+/**
+ *******************************************************************************
+ * @file        databuffer_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file to handle chained databuffers.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _DATABUFFER_CFG_H_
+#define _DATABUFFER_CFG_H_
+
+/**
+ *  Comment this Define to link the DataBuffer-Elements in both directions and
+ *  to store the total length of the chain in every element. The compact
+ *  layout only keeps the forward link and saves 6 Bytes per element on the
+ *  AVR (9 instead of 15 Bytes), the total length is calculated by walking
+ *  the chain.
+ */
+#define DATABUFFER_COMPACT
+
+/**
+ *  Number of DataBuffer-Elements (segment-descriptors) in the pool.
+ */
+#define DATABUFFER_POOL_SEGMENTS                (16)
+
+/**
+ *  Size of a small Data-Block in Bytes.                                      @n
+ *  Small blocks hold headers, options and short messages.
+ */
+#define DATABUFFER_POOL_SMALLBLOCK_SIZE         (64)
+
+/**
+ *  Number of small Data-Blocks in the pool.
+ */
+#define DATABUFFER_POOL_SMALLBLOCKS             (8)
+
+/**
+ *  Size of a large Data-Block in Bytes.                                      @n
+ *  A large block must be able to hold a whole frame of the data-link-layer
+ *  (e.g. NET_PPP_MTU_MAX + 2 Bytes FCS).
+ */
+#define DATABUFFER_POOL_LARGEBLOCK_SIZE         (600)
+
+/**
+ *  Number of large Data-Blocks in the pool.                                  @n
+ *  The PPP-Module holds one block for the frame in reception and one for
+ *  each frame in its RX-Queue, two more are left for the other users (e.g.
+ *  the LCP-Options, the frame-capture and databuffer_coalesce). So it must
+ *  be at least NET_PPP_RX_PACKET_BUFFER_SIZE + 2.
+ */
+#define DATABUFFER_POOL_LARGEBLOCKS             (4)
+
+/**
+ *  Maximum number of DataBuffer-Chains of a databuffer_queue_t. Every queue
+ *  holds a pointer and a length for each of them.
+ */
+#define DATABUFFER_QUEUE_MAX_PACKETS            (4)
+
+/**
+ *  Segments shorter than this number of Bytes are merged with their small
+ *  neighbours by databuffer_coalesce.
+ */
+#define DATABUFFER_COALESCE_THRESHOLD           (32)
+
+#endif /* _DATABUFFER_CFG_H_ */
@@ -0,0 +1,180 @@
+/**
+ *******************************************************************************
+ * @file        eventLog.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the event-log.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "eventLog.h"
+#include "eventLog_cfg.h"
+#include "ringbuffer.h"
+#include "serialConsole.h"
+#include "serialConsole_cfg.h"
+
+#include "..\\system.h"
+
+#include <string.h>
+#include <util/atomic.h>
+
+#if !RINGBUFFER_SIZE_IS_VALID(EVENTLOG_BUFFERSIZE)
+        #error "EVENTLOG_BUFFERSIZE must be a power of two from 2 to 128"
+#endif
+
+#if (EVENTLOG_ARGS_MAX + 3) > SERIALCONSOLE_TX_BUFFERSIZE
+        #error "EVENTLOG_ARGS_MAX does not fit into the TX-Buffer of the serial console"
+#endif
+
+#if (EVENTLOG_ARGS_MAX + 2) > EVENTLOG_BUFFERSIZE
+        #error "EVENTLOG_ARGS_MAX does not fit into EVENTLOG_BUFFERSIZE"
+#endif
+
+#if (EVENTLOG_DATA_MAX + 1) > EVENTLOG_ARGS_MAX
+        #error "EVENTLOG_DATA_MAX does not fit into EVENTLOG_ARGS_MAX"
+#endif
+
+// private function prototypes
+static bool readEvent(void);
+
+// data
+uint8_t                    eventLog_level;
+static uint8_t             bufferData[EVENTLOG_BUFFERSIZE];
+static struct ringbuffer_t buffer;
+static volatile uint8_t    droppedCount;
+
+/**
+ *  Event that is transmitted next: marker, ID, length and arguments.
+ */
+static uint8_t             event[3 + EVENTLOG_ARGS_MAX];
+static uint8_t             eventLength;
+
+// public functions
+void eventLog_init(void)
+{
+        ringbuffer_init(&buffer, bufferData, EVENTLOG_BUFFERSIZE);
+        droppedCount = 0;
+        eventLength = 0;
+        eventLog_level = EVENTLOG_LEVEL_RUNTIME;
+}
+
+bool eventLog_setLevel(uint8_t level)
+{
+        if (level > EVENTLOG_LEVEL_DEBUG)
+                return false;
+        
+        eventLog_level = level;
+        return true;
+}
+
+void eventLog_write(enum eventLog_id_e id, const void *args, uint8_t length)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                // the producers are serialized, an event is never split
+                if (ringbuffer_getFree(&buffer) < length + 2) {
+                        if (droppedCount < UINT8_MAX)
+                                droppedCount++;
+                } else {
+                        ringbuffer_put(&buffer, (uint8_t)id);
+                        ringbuffer_put(&buffer, length);
+                        ringbuffer_write(&buffer, (const uint8_t *)args, length);
+                }
+        }
+}
+
+void eventLog_writeChain(enum eventLog_id_e id,
+                         const void *args,
+                         uint8_t length,
+                         struct databuffer_basic_t *chain)
+{
+        struct databuffer_cursor_t cursor;
+        uint8_t data[EVENTLOG_ARGS_MAX];
+        uint8_t dataLength;
+
+        if (length > EVENTLOG_ARGS_MAX - 1)
+                length = EVENTLOG_ARGS_MAX - 1;
+        if (length > 0)
+                memcpy(data, args, length);
+
+        // the chain is copied before the interrupts are disabled
+        databuffer_cursor_init(&cursor, chain, 0);
+        dataLength = EVENTLOG_ARGS_MAX - 1 - length;
+        if (dataLength > EVENTLOG_DATA_MAX)
+                dataLength = EVENTLOG_DATA_MAX;
+        if (dataLength > databuffer_cursor_getRemaining(&cursor))
+                dataLength = databuffer_cursor_getRemaining(&cursor);
+        data[length] = dataLength;
+        databuffer_cursor_read(&cursor, &data[length + 1], dataLength);
+
+        eventLog_write(id, data, length + 1 + dataLength);
+}
+
+void eventLog_loop(void)
+{
+        while ((eventLength != 0) || readEvent()) {
+                if (serialConsole_getTxFree() < eventLength)
+                        return;
+
+                serialConsole_txBytes(event, eventLength);
+                eventLength = 0;
+        }
+}
+
+// private functions
+static bool readEvent(void)
+{
+        uint8_t count;
+
+        event[0] = EVENTLOG_MARKER;
+        if (ringbuffer_get(&buffer, &event[1])) {
+                // the producer has written the whole event at once
+                ringbuffer_get(&buffer, &event[2]);
+                ringbuffer_read(&buffer, &event[3], event[2]);
+        } else {
+                ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                        count = droppedCount;
+                        droppedCount = 0;
+                }
+                if (count == 0)
+                        return false;
+
+                // report the dropped events after the recorded ones
+                event[1] = EVENTLOG_EVENTLOG_DROPPED;
+                event[2] = 1;
+                event[3] = count;
+        }
+
+        eventLength = 3 + event[2];
+        return true;
+}
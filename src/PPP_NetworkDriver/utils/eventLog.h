@@ -0,0 +1,184 @@
+/**
+ *******************************************************************************
+ * @file        eventLog.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the event-log. Instead of formatting text on
+ *              the packet-path, an event is recorded as its ID and the raw
+ *              arguments into a ring-buffer. eventLog_loop transmits the
+ *              events over the serial console as soon as it has room, and
+ *              host/eventLog_decode.py turns them back into text.            @n
+ *              An event is transmitted as EVENTLOG_MARKER, the ID, the
+ *              length of the arguments and the arguments. The events are
+ *              listed in eventLog_events.h.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _EVENTLOG_H_
+#define _EVENTLOG_H_
+
+#include "..\\system.h"
+
+#include "databuffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  First Byte of an event on the serial console (ASCII Record-Separator), it
+ *  separates the events from other output.
+ */
+#define EVENTLOG_MARKER (0x1E)
+
+/**
+ *  Log-levels of the modules. A module records the events of its level and
+ *  of the lower levels (see eventLog_level.h). The values can be used by
+ *  #if. The events that are compiled in are filtered again by the level of
+ *  eventLog_setLevel at run-time.
+ */
+#define EVENTLOG_LEVEL_NONE     (0)
+#define EVENTLOG_LEVEL_ERROR    (1)
+#define EVENTLOG_LEVEL_WARNING  (2)
+#define EVENTLOG_LEVEL_INFO     (3)
+#define EVENTLOG_LEVEL_DEBUG    (4)
+
+/**
+ *  IDs of the events, EVENTLOG_<name> for each entry of eventLog_events.h.
+ */
+enum eventLog_id_e {
+#define EVENTLOG_EVENT(_name_, _format_) CONCAT2(EVENTLOG_, _name_),
+#include "eventLog_events.h"
+#undef EVENTLOG_EVENT
+        EVENTLOG_NUMBER_OF_EVENTS
+};
+
+/**
+ *  Log-level that is selected at run-time, use eventLog_setLevel to change
+ *  it. It is a single Byte, so it is read atomically by interrupt service
+ *  routines.
+ */
+extern uint8_t eventLog_level;
+
+/**
+ *  Checks if the events of a log-level are recorded at run-time.
+ *  @param      _level_: Log-level (EVENTLOG_LEVEL_*).
+ */
+#define eventLog_isLevelEnabled(_level_)        \
+        ((_level_) <= eventLog_level)
+
+/**
+ *  Executes a call that records an event if its log-level is enabled at
+ *  run-time. It is used by the macros of eventLog_level.h.
+ *  @param      _level_: Log-level (EVENTLOG_LEVEL_*).
+ *  @param      _call_: Call of eventLog_write or similar.
+ */
+#define EVENTLOG_CALL(_level_, _call_)                  \
+        do {                                            \
+                if (eventLog_isLevelEnabled(_level_))   \
+                        _call_;                         \
+        } while (0)
+
+/**
+ *  Initializes the event-log.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The event-log is empty.
+ */
+void eventLog_init(void);
+
+/**
+ *  Selects the log-level at run-time. Levels above the log-level of a module
+ *  (e.g. NET_PPP_LOG_LEVEL) have no effect on it, their events are not
+ *  compiled in.
+ *  @param      level: Log-level (EVENTLOG_LEVEL_*).
+ *  @return     False if the level is invalid, it is not changed then.
+ *  @pre        The function eventLog_init had been called.
+ *  @post       None.
+ */
+bool eventLog_setLevel(uint8_t level);
+
+/**
+ *  Records an event. It can be called by the main loop and by interrupt
+ *  service routines, the interrupts are disabled while the event is copied.
+ *  @param      id: ID of the event.
+ *  @param      args: Arguments of the event (see eventLog_events.h) or NULL.
+ *  @param      length: Length of the arguments in Bytes (at most
+ *              EVENTLOG_ARGS_MAX).
+ *  @return     None.
+ *  @pre        The function eventLog_init had been called.
+ *  @post       The event is dropped and counted if the buffer is full.
+ */
+void eventLog_write(enum eventLog_id_e id, const void *args, uint8_t length);
+
+/**
+ *  Records an event whose last argument is the data of a DataBuffer-Chain
+ *  ({hex} or {text}). At most EVENTLOG_DATA_MAX Bytes of the chain are
+ *  recorded.
+ *  @param      id: ID of the event.
+ *  @param      args: Arguments in front of the data or NULL.
+ *  @param      length: Length of the arguments in Bytes.
+ *  @param      chain: DataBuffer-Chain or NULL.
+ *  @return     None.
+ *  @pre        The function eventLog_init had been called.
+ *  @post       The event is dropped and counted if the buffer is full.
+ */
+void eventLog_writeChain(enum eventLog_id_e id,
+                         const void *args,
+                         uint8_t length,
+                         struct databuffer_basic_t *chain);
+
+/**
+ *  Records an event without arguments.
+ *  @param      _id_: ID of the event.
+ */
+#define eventLog_writeEvent(_id_)       \
+        eventLog_write(_id_, NULL, 0)
+
+/**
+ *  Transmits the recorded events over the serial console. It never waits,
+ *  an event stays in the buffer until the TX-Buffer of the serial console
+ *  has room for it.
+ *  @return     None.
+ *  @pre        The functions eventLog_init and serialConsole_init had been
+ *              called.
+ *  @post       None.
+ */
+void eventLog_loop(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _EVENTLOG_H_ */
@@ -0,0 +1,69 @@
+/**
+ *******************************************************************************
+ * @file        eventLog_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file of the event-log.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _EVENTLOG_CFG_H_
+#define _EVENTLOG_CFG_H_
+
+/**
+ *  Size of the buffer that holds the recorded events in Bytes. Each event
+ *  needs 2 Bytes plus its arguments.                                         @n
+ *  Must be a power of two from 2 to 128!
+ */
+#define EVENTLOG_BUFFERSIZE (128)
+
+/**
+ *  Maximum size of the arguments of an event in Bytes, including the length
+ *  and the data of a DataBuffer-Chain (see eventLog_writeChain).             @n
+ *  3 Bytes more must fit into the TX-Buffer of the serial console.
+ */
+#define EVENTLOG_ARGS_MAX (32)
+
+/**
+ *  Maximum number of Bytes that are recorded of a DataBuffer-Chain, the rest
+ *  is truncated.
+ */
+#define EVENTLOG_DATA_MAX (16)
+
+/**
+ *  Log-level at run-time after eventLog_init (see eventLog_setLevel).
+ */
+#define EVENTLOG_LEVEL_RUNTIME (EVENTLOG_LEVEL_DEBUG)
+
+#endif /* _EVENTLOG_CFG_H_ */
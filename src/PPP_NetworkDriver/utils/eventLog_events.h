@@ -0,0 +1,90 @@
+/**
+ *******************************************************************************
+ * @file        eventLog_events.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       List of the events of the event-log. The firmware only uses
+ *              the position of an event as its ID, the format is read by the
+ *              decoder of the host (host/eventLog_decode.py). New events are
+ *              appended, so the IDs of the old ones do not change.           @n
+ *              The arguments are written in the order of the format:         @n
+ *              {u8}   -> 8-Bit-Value, decimal.                               @n
+ *              {u16}  -> 16-Bit-Value (little-endian), decimal.              @n
+ *              {x16}  -> 16-Bit-Value (little-endian), hexadecimal.          @n
+ *              {u32}  -> 32-Bit-Value (little-endian), decimal.              @n
+ *              {ip}   -> IPv4-Address, 4 Bytes in network byte order.        @n
+ *              {hex}  -> Length-Byte and data, printed in hexadecimal.       @n
+ *              {text} -> Length-Byte and data, printed as characters.
+ *              The data of {hex} and {text} must be the last argument (see
+ *              eventLog_writeChain).
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+// no include-guard, the file is included for each use of EVENTLOG_EVENT
+
+// eventLog
+EVENTLOG_EVENT(EVENTLOG_DROPPED,         "eventLog: {u8} events dropped")
+
+// PPP
+EVENTLOG_EVENT(PPP_ESTABLISH,            "PPPState_Establish")
+EVENTLOG_EVENT(PPP_RX_PROTOCOL_UNKNOWN,  "PPP: unknown protocol {x16}")
+EVENTLOG_EVENT(PPP_RX_FCS_INVALID,       "PPP: protocol {x16}, FCS {x16} != {x16}")
+EVENTLOG_EVENT(PPP_RX_UNKNOWN,           "recv_?: {hex}")
+EVENTLOG_EVENT(PPP_BAUDRATE,             "PPP: {u32} Baud, error {u16}/1000")
+
+// LCP
+EVENTLOG_EVENT(LCP_CONFIGURE_REQUEST,    "LCP_ConfigureRequest: {hex}")
+EVENTLOG_EVENT(LCP_CONFIGURE_ACK,        "LCP_ConfigureAck: {hex}")
+EVENTLOG_EVENT(LCP_CONFIGURE_NAK,        "LCP_ConfigureNak: {hex}")
+EVENTLOG_EVENT(LCP_CONFIGURE_REJECT,     "LCP_ConfigureReject: {hex}")
+EVENTLOG_EVENT(LCP_TERMINATE_REQUEST,    "LCP_TerminateRequest: {hex}")
+EVENTLOG_EVENT(LCP_TERMINATE_ACK,        "LCP_TerminateAck: {hex}")
+EVENTLOG_EVENT(LCP_CODE_REJECT,          "LCP_CodeReject: {hex}")
+EVENTLOG_EVENT(LCP_PROTOCOL_REJECT,      "LCP_ProtocolReject: {hex}")
+EVENTLOG_EVENT(LCP_ECHO_REQUEST,         "LCP_EchoRequest: {hex}")
+EVENTLOG_EVENT(LCP_ECHO_REPLY,           "LCP_EchoReply: {hex}")
+EVENTLOG_EVENT(LCP_DISCARD_REQUEST,      "LCP_DiscardRequest: {hex}")
+EVENTLOG_EVENT(LCP_UNKNOWN,              "LCP_unknown: {hex}")
+
+// IPV4
+EVENTLOG_EVENT(IPV4_CHECKSUM_INVALID,    "IP.checksum invalid")
+EVENTLOG_EVENT(IPV4_NOT_MY_IP,           "not my IP")
+EVENTLOG_EVENT(IPV4_VERSION_INVALID,     "IP.version != 4")
+EVENTLOG_EVENT(IPV4_RX_UNKNOWN,          "recv_IP_?[{ip}] = {hex}")
+
+// UDP
+EVENTLOG_EVENT(UDP_RX,                   "recv_UDP[{ip}]:{u16}->{u16} = '{text}'")
+
+// TCP
+EVENTLOG_EVENT(TCP_RX,                   "recv_TCP[{ip}]:{u16}->{u16} = '{text}'")
@@ -0,0 +1,92 @@
+/**
+ *******************************************************************************
+ * @file        eventLog_level.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Defines the log-macros of a module by its log-level. A module
+ *              defines EVENTLOG_MODULE_LEVEL and includes this file after
+ *              eventLog.h:                                                   @n
+ *              #define EVENTLOG_MODULE_LEVEL NET_LCP_LOG_LEVEL               @n
+ *              #include "..\\..\\utils\\eventLog_level.h"                    @n
+ *              EVENTLOG_ERROR, EVENTLOG_WARNING, EVENTLOG_INFO and
+ *              EVENTLOG_DEBUG expand to their argument if the level is
+ *              enabled and to an empty statement otherwise, so a disabled
+ *              event leaves no code and no data in the program. The enabled
+ *              events are filtered by eventLog_setLevel at run-time.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+// no include-guard, the file is included once by each module
+
+#ifndef EVENTLOG_MODULE_LEVEL
+        #error "EVENTLOG_MODULE_LEVEL must be defined before eventLog_level.h"
+#endif
+
+#if (EVENTLOG_MODULE_LEVEL < EVENTLOG_LEVEL_NONE) || \
+    (EVENTLOG_MODULE_LEVEL > EVENTLOG_LEVEL_DEBUG)
+        #error "EVENTLOG_MODULE_LEVEL must be one of EVENTLOG_LEVEL_*"
+#endif
+
+#undef EVENTLOG_ERROR
+#undef EVENTLOG_WARNING
+#undef EVENTLOG_INFO
+#undef EVENTLOG_DEBUG
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_ERROR
+        #define EVENTLOG_ERROR(_call_)          \
+                EVENTLOG_CALL(EVENTLOG_LEVEL_ERROR, _call_)
+#else
+        #define EVENTLOG_ERROR(_call_)          do {} while (0)
+#endif
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_WARNING
+        #define EVENTLOG_WARNING(_call_)        \
+                EVENTLOG_CALL(EVENTLOG_LEVEL_WARNING, _call_)
+#else
+        #define EVENTLOG_WARNING(_call_)        do {} while (0)
+#endif
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_INFO
+        #define EVENTLOG_INFO(_call_)           \
+                EVENTLOG_CALL(EVENTLOG_LEVEL_INFO, _call_)
+#else
+        #define EVENTLOG_INFO(_call_)           do {} while (0)
+#endif
+
+#if EVENTLOG_MODULE_LEVEL >= EVENTLOG_LEVEL_DEBUG
+        #define EVENTLOG_DEBUG(_call_)          \
+                EVENTLOG_CALL(EVENTLOG_LEVEL_DEBUG, _call_)
+#else
+        #define EVENTLOG_DEBUG(_call_)          do {} while (0)
+#endif
@@ -1,11 +1,14 @@
 /**
  *******************************************************************************
  * @file        myUtils.h
- * @version     0.0.1
- * @date        2017.09.21
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       This file defines gcc specific helper-functions.
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added COMPILER_BARRIER. (MS)
+ *
  * @since       V0.0.1, 2017.09.21:
  *                      -# Initial version. (MS)
  *
@@ -72,6 +75,14 @@
 #define __same_type(_a_, _b_)   \
         __builtin_types_compatible_p(__typeof__(_a_), __typeof__(_b_))
 
+/**
+ *  This Macro prevents the compiler from moving memory-accesses across it,
+ *  e.g. to write data before the index that publishes it to an interrupt
+ *  service routine. It generates no instruction.
+ */
+#define COMPILER_BARRIER()      \
+        __asm__ __volatile__("" ::: "memory")
+
 /**
  *  This Macro will define the byte order.
  */
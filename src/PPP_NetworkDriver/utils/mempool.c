@@ -0,0 +1,125 @@
+/**
+ *******************************************************************************
+ * @file        mempool.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of a fixed-size block pool.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "mempool.h"
+
+#include "..\\system.h"
+
+#include <util/atomic.h>
+
+// public functions
+void mempool_init(struct mempool_t *pool,
+                  void *storage,
+                  uint16_t size,
+                  uint16_t numberOfBlocks)
+{
+        uint8_t *block = (uint8_t *)storage;
+
+        pool->blockSize = MEMPOOL_BLOCKSIZE(size);
+        pool->numberOfBlocks = numberOfBlocks;
+        pool->storageStart = block;
+        pool->storageEnd = block + pool->blockSize * numberOfBlocks;
+
+        // link all blocks into the list of free blocks
+        pool->freeList = NULL;
+        while (numberOfBlocks--) {
+                *((void **)block) = pool->freeList;
+                pool->freeList = block;
+                block += pool->blockSize;
+        }
+
+        pool->numberOfUsedBlocks = 0;
+        pool->highWaterMark = 0;
+        pool->allocFailures = 0;
+}
+
+void *mempool_alloc(struct mempool_t *pool)
+{
+        void *block;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                block = pool->freeList;
+
+                if (block != NULL) {
+                        pool->freeList = *((void **)block);
+
+                        pool->numberOfUsedBlocks++;
+                        if (pool->numberOfUsedBlocks > pool->highWaterMark)
+                                pool->highWaterMark = pool->numberOfUsedBlocks;
+                } else {
+                        pool->allocFailures++;
+                }
+        }
+
+        return block;
+}
+
+void mempool_free(struct mempool_t *pool, void *block)
+{
+        if (block == NULL)
+                return;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                *((void **)block) = pool->freeList;
+                pool->freeList = block;
+
+                pool->numberOfUsedBlocks--;
+        }
+}
+
+void mempool_getStatistics(struct mempool_t *pool,
+                           struct mempool_statistics_t *statistics)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                statistics->blockSize = pool->blockSize;
+                statistics->numberOfBlocks = pool->numberOfBlocks;
+                statistics->numberOfUsedBlocks = pool->numberOfUsedBlocks;
+                statistics->highWaterMark = pool->highWaterMark;
+                statistics->allocFailures = pool->allocFailures;
+        }
+}
+
+void mempool_resetStatistics(struct mempool_t *pool)
+{
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                pool->highWaterMark = pool->numberOfUsedBlocks;
+                pool->allocFailures = 0;
+        }
+}
@@ -0,0 +1,250 @@
+/**
+ *******************************************************************************
+ * @file        mempool.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of a fixed-size block pool.
+ *              A pool hands out blocks of a single size from a static
+ *              storage-array. Allocation and release take constant time and
+ *              may be called from interrupt service routines as well as from
+ *              the main loop.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _MEMPOOL_H_
+#define _MEMPOOL_H_
+
+#include "..\\system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Alignment of the blocks in Bytes.                                         @n
+ *  The AVR has no alignment-restrictions, other platforms need at least the
+ *  alignment of a pointer because free blocks are linked through their first
+ *  Bytes.
+ */
+#ifdef __AVR__
+        #define MEMPOOL_ALIGNMENT       (1)
+#else
+        #define MEMPOOL_ALIGNMENT       (sizeof(void *))
+#endif /* __AVR__ */
+
+/**
+ *  Calculates the size of a single block in the storage-array. A block must at
+ *  least be able to hold the pointer to the next free block.
+ *  @param      _size_: Requested size of a block in Bytes.
+ *  @return     Size of a block in Bytes.
+ */
+#define MEMPOOL_BLOCKSIZE(_size_)                                       \
+        (((((size_t)(_size_) > sizeof(void *) ? (size_t)(_size_)       \
+                                              : sizeof(void *))         \
+           + MEMPOOL_ALIGNMENT - 1) / MEMPOOL_ALIGNMENT) * MEMPOOL_ALIGNMENT)
+
+/**
+ *  Defines a static storage-array that can be used by a pool.
+ *  @param      _name_: Name of the storage-array.
+ *  @param      _size_: Requested size of a block in Bytes.
+ *  @param      _numberOfBlocks_: Number of blocks in the pool.
+ */
+#define MEMPOOL_STORAGE(_name_, _size_, _numberOfBlocks_)               \
+        static void *_name_[(MEMPOOL_BLOCKSIZE(_size_) * (_numberOfBlocks_) \
+                             + sizeof(void *) - 1) / sizeof(void *)]
+
+/**
+ *  This structure defines a pool of blocks with a fixed size.
+ */
+struct mempool_t {
+        /**
+         * Pointer to the first free block. The free blocks are linked through
+         * their first Bytes.
+         */
+        void                           *freeList;
+
+        /**
+         * Pointer to the first Byte of the storage-array.
+         */
+        uint8_t                        *storageStart;
+
+        /**
+         * Pointer behind the last Byte of the storage-array.
+         */
+        uint8_t                        *storageEnd;
+
+        /**
+         * Size of a single block in Bytes.
+         */
+        uint16_t                        blockSize;
+
+        /**
+         * Number of blocks in the pool.
+         */
+        uint16_t                        numberOfBlocks;
+
+        /**
+         * Number of blocks that are currently allocated.
+         */
+        uint16_t                        numberOfUsedBlocks;
+
+        /**
+         * Maximum number of blocks that had been allocated at the same time.
+         */
+        uint16_t                        highWaterMark;
+
+        /**
+         * Number of allocations that failed because the pool was empty.
+         */
+        uint16_t                        allocFailures;
+};
+
+/**
+ *  This structure holds a snapshot of the statistics of a pool.
+ */
+struct mempool_statistics_t {
+        /**
+         * Size of a single block in Bytes.
+         */
+        uint16_t                        blockSize;
+
+        /**
+         * Number of blocks in the pool.
+         */
+        uint16_t                        numberOfBlocks;
+
+        /**
+         * Number of blocks that are currently allocated.
+         */
+        uint16_t                        numberOfUsedBlocks;
+
+        /**
+         * Maximum number of blocks that had been allocated at the same time.
+         */
+        uint16_t                        highWaterMark;
+
+        /**
+         * Number of allocations that failed because the pool was empty.
+         */
+        uint16_t                        allocFailures;
+};
+
+/**
+ *  Initializes a pool and links all blocks of the storage-array into the list
+ *  of free blocks.
+ *  @param      pool: Pool to initialize.
+ *  @param      storage: Storage-array (see MEMPOOL_STORAGE).
+ *  @param      size: Requested size of a block in Bytes (the same value that
+ *              has been passed to MEMPOOL_STORAGE).
+ *  @param      numberOfBlocks: Number of blocks in the storage-array.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       All blocks of the pool are free and the statistics are reset.
+ */
+void mempool_init(struct mempool_t *pool,
+                  void *storage,
+                  uint16_t size,
+                  uint16_t numberOfBlocks);
+
+/**
+ *  Takes a block from the pool.                                              @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      pool: Pool to allocate from.
+ *  @return     Pointer to the block or NULL if the pool is empty.
+ *  @pre        The function mempool_init had been called.
+ *  @post       If NULL has been returned the allocation-failure-counter had
+ *              been increased, otherwise the high-water-mark had been updated.
+ */
+void *mempool_alloc(struct mempool_t *pool);
+
+/**
+ *  Returns a block to the pool.                                              @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      pool: Pool the block had been allocated from.
+ *  @param      block: Pointer to the block. NULL will be ignored.
+ *  @return     None.
+ *  @pre        The block had been allocated by mempool_alloc from the same
+ *              pool.
+ *  @post       The block can be allocated again.
+ */
+void mempool_free(struct mempool_t *pool, void *block);
+
+/**
+ *  Copies the statistics of a pool.
+ *  @param      pool: Pool.
+ *  @param      statistics: Buffer that will hold the statistics.
+ *  @return     None.
+ *  @pre        The function mempool_init had been called.
+ *  @post       The buffer holds a consistent snapshot of the statistics.
+ */
+void mempool_getStatistics(struct mempool_t *pool,
+                           struct mempool_statistics_t *statistics);
+
+/**
+ *  Resets the high-water-mark to the current number of used blocks and clears
+ *  the allocation-failure-counter.
+ *  @param      pool: Pool.
+ *  @return     None.
+ *  @pre        The function mempool_init had been called.
+ *  @post       The statistics had been reset.
+ */
+void mempool_resetStatistics(struct mempool_t *pool);
+
+/**
+ *  Checks if a pointer points into the storage-array of a pool.
+ *  @param      _pool_: Pointer to the pool.
+ *  @param      _p_: Pointer to check.
+ *  @return     True if the pointer points into the storage-array.
+ *  @pre        The function mempool_init had been called.
+ *  @post       None.
+ */
+#define mempool_contains(_pool_, _p_)                                   \
+        (((uint8_t *)(_p_) >= (_pool_)->storageStart) &&                \
+         ((uint8_t *)(_p_) <  (_pool_)->storageEnd))
+
+/**
+ *  Returns the number of free blocks of a pool.
+ *  @param      _pool_: Pointer to the pool.
+ *  @return     Number of free blocks.
+ *  @pre        The function mempool_init had been called.
+ *  @post       None.
+ */
+#define mempool_getFreeCount(_pool_)                                    \
+        ((_pool_)->numberOfBlocks - (_pool_)->numberOfUsedBlocks)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _MEMPOOL_H_ */
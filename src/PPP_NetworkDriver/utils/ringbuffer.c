@@ -0,0 +1,143 @@
+/**
+ *******************************************************************************
+ * @file        ringbuffer.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of a lock-free ring-buffer for Bytes with a single
+ *              producer and a single consumer.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "ringbuffer.h"
+
+#include "..\\system.h"
+
+#include <string.h>
+
+// external definitions of the inline functions
+extern inline uint8_t ringbuffer_getCount(const struct ringbuffer_t *ring);
+extern inline uint8_t ringbuffer_getFree(const struct ringbuffer_t *ring);
+extern inline bool ringbuffer_put(struct ringbuffer_t *ring, uint8_t b);
+extern inline bool ringbuffer_get(struct ringbuffer_t *ring, uint8_t *b);
+
+// public functions
+void ringbuffer_init(struct ringbuffer_t *ring, uint8_t *buffer, uint8_t size)
+{
+        ring->buffer = buffer;
+        ring->mask = size - 1;
+        ring->head = 0;
+        ring->tail = 0;
+}
+
+uint8_t ringbuffer_getReadSpan(struct ringbuffer_t *ring, uint8_t **data)
+{
+        uint8_t offset = ring->tail & ring->mask;
+        uint8_t count = ringbuffer_getCount(ring);
+        uint8_t contiguous = ring->mask + 1 - offset;
+
+        *data = &ring->buffer[offset];
+        return count < contiguous ? count : contiguous;
+}
+
+void ringbuffer_commitRead(struct ringbuffer_t *ring, uint8_t length)
+{
+        // the Bytes are read before the producer can overwrite them
+        COMPILER_BARRIER();
+        ring->tail += length;
+}
+
+uint8_t ringbuffer_getWriteSpan(struct ringbuffer_t *ring, uint8_t **data)
+{
+        uint8_t offset = ring->head & ring->mask;
+        uint8_t free = ringbuffer_getFree(ring);
+        uint8_t contiguous = ring->mask + 1 - offset;
+
+        *data = &ring->buffer[offset];
+        return free < contiguous ? free : contiguous;
+}
+
+void ringbuffer_commitWrite(struct ringbuffer_t *ring, uint8_t length)
+{
+        // the Bytes are written before the consumer can see them
+        COMPILER_BARRIER();
+        ring->head += length;
+}
+
+uint16_t ringbuffer_write(struct ringbuffer_t *ring,
+                          const uint8_t *data,
+                          uint16_t length)
+{
+        uint16_t numberOfWrittenBytes = 0;
+        uint8_t *span;
+        uint8_t spanLength;
+
+        // the free space wraps around at most once
+        while ((length > 0) &&
+               ((spanLength = ringbuffer_getWriteSpan(ring, &span)) > 0)) {
+                if (spanLength > length)
+                        spanLength = length;
+                memcpy(span, data, spanLength);
+                ringbuffer_commitWrite(ring, spanLength);
+
+                data += spanLength;
+                length -= spanLength;
+                numberOfWrittenBytes += spanLength;
+        }
+
+        return numberOfWrittenBytes;
+}
+
+uint16_t ringbuffer_read(struct ringbuffer_t *ring,
+                         uint8_t *data,
+                         uint16_t length)
+{
+        uint16_t numberOfReadBytes = 0;
+        uint8_t *span;
+        uint8_t spanLength;
+
+        // the used space wraps around at most once
+        while ((length > 0) &&
+               ((spanLength = ringbuffer_getReadSpan(ring, &span)) > 0)) {
+                if (spanLength > length)
+                        spanLength = length;
+                memcpy(data, span, spanLength);
+                ringbuffer_commitRead(ring, spanLength);
+
+                data += spanLength;
+                length -= spanLength;
+                numberOfReadBytes += spanLength;
+        }
+
+        return numberOfReadBytes;
+}
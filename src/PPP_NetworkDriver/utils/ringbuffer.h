@@ -0,0 +1,245 @@
+/**
+ *******************************************************************************
+ * @file        ringbuffer.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of a lock-free ring-buffer for Bytes with a single
+ *              producer and a single consumer, e.g. an interrupt service
+ *              routine and the main loop.
+ *              The producer only changes the head, the consumer only the
+ *              tail. Both indices are 8-Bit, so they are read and written
+ *              atomically by the AVR and no critical section is needed. They
+ *              run freely and are masked with the size, which is a power of
+ *              two of at most 128 Bytes.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _RINGBUFFER_H_
+#define _RINGBUFFER_H_
+
+#include "..\\system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Checks if a size can be used for a ring-buffer: a power of two from 2 to
+ *  128. It can be used by #if.
+ *  The Parameters are:
+ *      -# size: Size of the ring-buffer in Bytes.
+ */
+#define RINGBUFFER_SIZE_IS_VALID(_size_)         \
+        (((_size_) >= 2) && ((_size_) <= 128) && \
+         (((_size_) & ((_size_) - 1)) == 0))
+
+/**
+ *  This structure holds the state of a ring-buffer.
+ */
+struct ringbuffer_t {
+        uint8_t                        *buffer;
+
+        /**
+         * Size of the buffer minus 1.
+         */
+        uint8_t                         mask;
+
+        /**
+         * Free-running index of the next Byte to write (producer).
+         */
+        volatile uint8_t                head;
+
+        /**
+         * Free-running index of the next Byte to read (consumer).
+         */
+        volatile uint8_t                tail;
+};
+
+/**
+ *  Initializes a ring-buffer.
+ *  @param      ring: Ring-buffer.
+ *  @param      buffer: Array that holds the Bytes.
+ *  @param      size: Size of the array (see RINGBUFFER_SIZE_IS_VALID).
+ *  @return     None.
+ *  @pre        Neither the producer nor the consumer access the ring-buffer.
+ *  @post       The ring-buffer is empty.
+ */
+void ringbuffer_init(struct ringbuffer_t *ring, uint8_t *buffer, uint8_t size);
+
+/**
+ *  Returns the number of Bytes that can be read.
+ *  @param      ring: Ring-buffer.
+ *  @return     Number of Bytes in the ring-buffer.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+inline uint8_t ringbuffer_getCount(const struct ringbuffer_t *ring)
+{
+        return (uint8_t)(ring->head - ring->tail);
+}
+
+/**
+ *  Returns the number of Bytes that can be written.
+ *  @param      ring: Ring-buffer.
+ *  @return     Number of free Bytes in the ring-buffer.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+inline uint8_t ringbuffer_getFree(const struct ringbuffer_t *ring)
+{
+        return ring->mask + 1 - ringbuffer_getCount(ring);
+}
+
+/**
+ *  Writes a Byte (producer).
+ *  @param      ring: Ring-buffer.
+ *  @param      b: Byte to write.
+ *  @return     False if the ring-buffer is full, the Byte is dropped then.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+inline bool ringbuffer_put(struct ringbuffer_t *ring, uint8_t b)
+{
+        uint8_t head = ring->head;
+
+        if ((uint8_t)(head - ring->tail) > ring->mask)
+                return false;
+
+        ring->buffer[head & ring->mask] = b;
+        // the Byte is written before the consumer can see it
+        COMPILER_BARRIER();
+        ring->head = head + 1;
+
+        return true;
+}
+
+/**
+ *  Reads a Byte (consumer).
+ *  @param      ring: Ring-buffer.
+ *  @param      b: Buffer for the read Byte.
+ *  @return     False if the ring-buffer is empty.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+inline bool ringbuffer_get(struct ringbuffer_t *ring, uint8_t *b)
+{
+        uint8_t tail = ring->tail;
+
+        if (ring->head == tail)
+                return false;
+
+        *b = ring->buffer[tail & ring->mask];
+        // the Byte is read before the producer can overwrite it
+        COMPILER_BARRIER();
+        ring->tail = tail + 1;
+
+        return true;
+}
+
+/**
+ *  Returns the contiguous Bytes that can be read without a wrap-around
+ *  (consumer). They stay valid until ringbuffer_commitRead is called.
+ *  @param      ring: Ring-buffer.
+ *  @param      data: Buffer for the pointer to the first Byte.
+ *  @return     Number of contiguous Bytes, 0 if the ring-buffer is empty.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+uint8_t ringbuffer_getReadSpan(struct ringbuffer_t *ring, uint8_t **data);
+
+/**
+ *  Releases Bytes that have been read by ringbuffer_getReadSpan (consumer).
+ *  @param      ring: Ring-buffer.
+ *  @param      length: Number of read Bytes.
+ *  @return     None.
+ *  @pre        length is at most the value of ringbuffer_getReadSpan.
+ *  @post       The producer may overwrite the Bytes.
+ */
+void ringbuffer_commitRead(struct ringbuffer_t *ring, uint8_t length);
+
+/**
+ *  Returns the contiguous free Bytes that can be written without a
+ *  wrap-around (producer).
+ *  @param      ring: Ring-buffer.
+ *  @param      data: Buffer for the pointer to the first free Byte.
+ *  @return     Number of contiguous free Bytes, 0 if the ring-buffer is full.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+uint8_t ringbuffer_getWriteSpan(struct ringbuffer_t *ring, uint8_t **data);
+
+/**
+ *  Publishes Bytes that have been written to ringbuffer_getWriteSpan
+ *  (producer).
+ *  @param      ring: Ring-buffer.
+ *  @param      length: Number of written Bytes.
+ *  @return     None.
+ *  @pre        length is at most the value of ringbuffer_getWriteSpan.
+ *  @post       The consumer may read the Bytes.
+ */
+void ringbuffer_commitWrite(struct ringbuffer_t *ring, uint8_t length);
+
+/**
+ *  Writes as many Bytes as fit into the ring-buffer (producer). The Bytes
+ *  are copied in at most two contiguous blocks.
+ *  @param      ring: Ring-buffer.
+ *  @param      data: Bytes to write.
+ *  @param      length: Number of Bytes.
+ *  @return     Number of written Bytes.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+uint16_t ringbuffer_write(struct ringbuffer_t *ring,
+                          const uint8_t *data,
+                          uint16_t length);
+
+/**
+ *  Reads as many Bytes as available (consumer). The Bytes are copied in at
+ *  most two contiguous blocks.
+ *  @param      ring: Ring-buffer.
+ *  @param      data: Buffer for the read Bytes.
+ *  @param      length: Size of the buffer.
+ *  @return     Number of read Bytes.
+ *  @pre        ringbuffer_init has been called.
+ *  @post       None.
+ */
+uint16_t ringbuffer_read(struct ringbuffer_t *ring,
+                         uint8_t *data,
+                         uint16_t length);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _RINGBUFFER_H_ */
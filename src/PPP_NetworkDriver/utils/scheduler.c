@@ -0,0 +1,193 @@
+/**
+ *******************************************************************************
+ * @file        scheduler.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the scheduler.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "scheduler.h"
+#include "scheduler_cfg.h"
+#include "timebase.h"
+
+#include "..\\system.h"
+
+#include <string.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+
+// private function prototypes
+static void handler_DUMMY(void);
+static void tick(void);
+
+// private data
+static volatile uint8_t pendingEvents;
+static volatile uint32_t postMicros;
+static volatile uint16_t timerTicks[SCHEDULER_EVENT_COUNT];
+static void (*handlers[SCHEDULER_EVENT_COUNT])(void);
+static struct scheduler_statistics_t statistics;
+
+// public functions
+void scheduler_init(void)
+{
+        uint8_t i;
+
+        // the pending events are a bit-mask
+        (void)BUILD_BUG_ON_ZERO(SCHEDULER_EVENT_COUNT > 8);
+        // a delay of 65535 ms fits into the ticks of a timer
+        (void)BUILD_BUG_ON_ZERO(TIMEBASE_US_PER_OVERFLOW < 1000);
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                pendingEvents = 0;
+                for (i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+                        timerTicks[i] = 0;
+                        handlers[i] = handler_DUMMY;
+                }
+        }
+        scheduler_resetStatistics();
+
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        timebase_setOverflowCallback(tick);
+}
+
+void scheduler_setHandler(enum scheduler_event_e event, void (*handler)(void))
+{
+        if ((event < SCHEDULER_EVENT_COUNT) && (handler != NULL))
+                handlers[event] = handler;
+}
+
+void scheduler_post(enum scheduler_event_e event)
+{
+        if (event >= SCHEDULER_EVENT_COUNT)
+                return;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                // the latency is measured from the first post
+                if (pendingEvents == 0)
+                        postMicros = timebase_getMicros();
+                pendingEvents |= BV(event);
+        }
+}
+
+void scheduler_postDelayed(enum scheduler_event_e event, uint16_t ms)
+{
+        uint16_t ticks;
+
+        if (event >= SCHEDULER_EVENT_COUNT)
+                return;
+        if (ms == 0) {
+                scheduler_post(event);
+                return;
+        }
+
+        // the next overflow may follow at once, so one tick more is needed
+        ticks = ((uint32_t)ms * 1000UL + TIMEBASE_US_PER_OVERFLOW - 1) /
+                TIMEBASE_US_PER_OVERFLOW + 1;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                timerTicks[event] = ticks;
+        }
+}
+
+void scheduler_run(void)
+{
+        uint8_t events;
+        uint32_t latency;
+        uint8_t i;
+
+        cli();
+        events = pendingEvents;
+        if (events == 0) {
+#ifdef SCHEDULER_SLEEP
+                // the instruction after sei is executed before any interrupt,
+                // so an interrupt that posts an event wakes the CPU up again
+                statistics.sleeps++;
+                sleep_enable();
+                sei();
+                sleep_cpu();
+                sleep_disable();
+#else
+                sei();
+#endif /* SCHEDULER_SLEEP */
+                return;
+        }
+        pendingEvents = 0;
+        latency = timebase_getMicros() - postMicros;
+        sei();
+
+        // the cycle-counter wraps every overflow of the time-base, so the
+        // latency is measured in microseconds and saturated
+        if (latency > UINT16_MAX)
+                latency = UINT16_MAX;
+        statistics.latencyLast = latency;
+        if (latency > statistics.latencyMax)
+                statistics.latencyMax = latency;
+
+        for (i = 0; events != 0; i++, events >>= 1) {
+                if (events & 0x01) {
+                        statistics.events++;
+                        handlers[i]();
+                }
+        }
+}
+
+void scheduler_getStatistics(struct scheduler_statistics_t *statisticsCopy)
+{
+        *statisticsCopy = statistics;
+}
+
+void scheduler_resetStatistics(void)
+{
+        memset(&statistics, 0, sizeof(statistics));
+}
+
+// private functions
+static void handler_DUMMY(void)
+{
+}
+
+/**
+ *  Called by the overflow interrupt of the time-base.
+ */
+static void tick(void)
+{
+        uint8_t i;
+
+        for (i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+                if ((timerTicks[i] != 0) && (--timerTicks[i] == 0))
+                        scheduler_post((enum scheduler_event_e)i);
+        }
+        scheduler_post(SCHEDULER_EVENT_TICK);
+}
@@ -0,0 +1,159 @@
+/**
+ *******************************************************************************
+ * @file        scheduler.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the scheduler. The interrupt service routines
+ *              post events (see scheduler_cfg.h) and scheduler_run calls the
+ *              handlers of the pending events in the main loop. Every handler
+ *              runs to completion. The CPU sleeps while no event is
+ *              pending.                                                      @n
+ *              The one-shot timers count the overflows of the time-base
+ *              (timebase.h), so they have a resolution of 4.096 ms at 16 MHz.
+ *              The statistics hold the time from the first post to the
+ *              dispatch of the events (wake-up latency).
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include "..\\system.h"
+
+#include "scheduler_cfg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  This structure holds a snapshot of the counters of the scheduler.
+ */
+struct scheduler_statistics_t {
+        /**
+         * Number of dispatched events.
+         */
+        uint16_t                        events;
+
+        /**
+         * Number of times the CPU entered the sleep-mode.
+         */
+        uint16_t                        sleeps;
+
+        /**
+         * Microseconds from the first post to the dispatch of the last
+         * events, saturated at UINT16_MAX.
+         */
+        uint16_t                        latencyLast;
+
+        /**
+         * Maximum of latencyLast.
+         */
+        uint16_t                        latencyMax;
+};
+
+/**
+ *  Initializes the scheduler. All events get a handler that does nothing.
+ *  @return     None.
+ *  @pre        The function timebase_init had been called.
+ *  @post       The tick of the time-base posts SCHEDULER_EVENT_TICK.
+ */
+void scheduler_init(void);
+
+/**
+ *  Sets the handler of an event.
+ *  @param      event: Event of the handler.
+ *  @param      handler: Function that is called by scheduler_run. NULL will be
+ *                       ignored.
+ *  @return     None.
+ *  @pre        scheduler_init has been called.
+ *  @post       None.
+ */
+void scheduler_setHandler(enum scheduler_event_e event, void (*handler)(void));
+
+/**
+ *  Marks an event as pending. An event that is posted again before its
+ *  dispatch is handled once.                                                 @n
+ *  This function may be called from an interrupt service routine.
+ *  @param      event: Event to post, an invalid event will be ignored.
+ *  @return     None.
+ *  @pre        scheduler_init has been called.
+ *  @post       scheduler_run calls the handler of the event.
+ */
+void scheduler_post(enum scheduler_event_e event);
+
+/**
+ *  Posts an event after a delay. A running timer of the event is restarted.
+ *  This function may be called from an interrupt service routine.
+ *  @param      event: Event to post, an invalid event will be ignored.
+ *  @param      ms: Minimum delay in milliseconds, at most 65535 (the range of
+ *                  the parameter). 0 posts the event at once.
+ *  @return     None.
+ *  @pre        scheduler_init has been called.
+ *  @post       None.
+ */
+void scheduler_postDelayed(enum scheduler_event_e event, uint16_t ms);
+
+/**
+ *  Calls the handlers of the pending events in the order of their priority or
+ *  lets the CPU sleep until the next interrupt. It is called by the main
+ *  loop.
+ *  @return     None.
+ *  @pre        scheduler_init has been called and the interrupts are enabled.
+ *  @post       The interrupts are enabled.
+ */
+void scheduler_run(void);
+
+/**
+ *  Copies the counters of the scheduler.
+ *  @param      statistics: Buffer that will hold the counters.
+ *  @return     None.
+ *  @pre        scheduler_init has been called.
+ *  @post       None.
+ */
+void scheduler_getStatistics(struct scheduler_statistics_t *statistics);
+
+/**
+ *  Sets the counters of the scheduler to 0.
+ *  @return     None.
+ *  @pre        scheduler_init has been called.
+ *  @post       None.
+ */
+void scheduler_resetStatistics(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _SCHEDULER_H_ */
@@ -0,0 +1,81 @@
+/**
+ *******************************************************************************
+ * @file        scheduler_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file of the scheduler.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _SCHEDULER_CFG_H_
+#define _SCHEDULER_CFG_H_
+
+/**
+ *  List of the events. The pending events are dispatched in this order, so
+ *  the first event has the highest priority.                                 @n
+ *  At most 8 events are possible! SCHEDULER_EVENT_TICK is required.
+ */
+enum scheduler_event_e {
+        /**
+         * A received frame is waiting for net_PPP_loop.
+         */
+        SCHEDULER_EVENT_PPP_RX,
+
+        /**
+         * The transmission of a frame has been finished.
+         */
+        SCHEDULER_EVENT_PPP_TX,
+
+        /**
+         * Timer of the sequence of the LCP-configuration.
+         */
+        SCHEDULER_EVENT_LCP_TIMER,
+
+        /**
+         * Posted every TIMEBASE_US_PER_OVERFLOW microseconds, e.g. for the
+         * serial console.
+         */
+        SCHEDULER_EVENT_TICK,
+
+        SCHEDULER_EVENT_COUNT
+};
+
+/**
+ *  Comment this Define to keep the CPU running while no event is pending.
+ *  Otherwise the CPU enters the idle sleep-mode and every interrupt wakes it
+ *  up.
+ */
+#define SCHEDULER_SLEEP
+
+#endif /* _SCHEDULER_CFG_H_ */
@@ -1,12 +1,24 @@
 /**
  *******************************************************************************
  * @file        serialConsole.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Source-file to handle input/output of serial data (strings,
  *              etc.).
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added serialConsole_txBytesP. (MS)
+ *                      -# The RX- and TX-Buffer are lock-free ring-buffers
+ *                         (see ringbuffer.h). (MS)
+ *                      -# The TX-Buffer is transmitted in contiguous spans.
+ *                         (MS)
+ *                      -# Added serialConsole_getTxFree. (MS)
+ *                      -# Added serialConsole_txBytesNonBlocking, the
+ *                         program-memory is copied in spans. (MS)
+ *                      -# Added serialConsole_txChain, the TX-Interrupt
+ *                         transmits the segments of queued chains. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -44,9 +56,22 @@
 
 #include "serialConsole.h"
 #include "serialConsole_cfg.h"
+#include "ringbuffer.h"
 
 #include "..\\system.h"
 
+#if !RINGBUFFER_SIZE_IS_VALID(SERIALCONSOLE_RX_BUFFERSIZE)
+        #error "SERIALCONSOLE_RX_BUFFERSIZE must be a power of two from 2 to 128"
+#endif
+
+#if !RINGBUFFER_SIZE_IS_VALID(SERIALCONSOLE_TX_BUFFERSIZE)
+        #error "SERIALCONSOLE_TX_BUFFERSIZE must be a power of two from 2 to 128"
+#endif
+
+#if !RINGBUFFER_SIZE_IS_VALID(SERIALCONSOLE_TX_CHAINS)
+        #error "SERIALCONSOLE_TX_CHAINS must be a power of two from 2 to 128"
+#endif
+
 #define SERIALCONSOLE_UARTPREFIX \
         CONCAT2(SERIALCONSOLE_UARTTYPE, SERIALCONSOLE_UARTNUMBER)
 #define SERIALCONSOLE_UARTINCLUDE  \
@@ -57,136 +82,256 @@
         CONCAT2(SERIALCONSOLE_UARTPREFIX, _setRxFinishedCallback)
 #define serialConsole_uart_setTxFinishedCallback \
         CONCAT2(SERIALCONSOLE_UARTPREFIX, _setTxFinishedCallback)
-#define serialConsole_uart_txByte \
-        CONCAT2(SERIALCONSOLE_UARTPREFIX, _txByte)
+#define serialConsole_uart_txBuffer \
+        CONCAT2(SERIALCONSOLE_UARTPREFIX, _txBuffer)
 
 #include SERIALCONSOLE_UARTINCLUDE
 
 
+// type-definitions
+/**
+ *  A queued DataBuffer-Chain and the position in the TX-Buffer where it was
+ *  inserted.
+ */
+struct txChain_t {
+        struct databuffer_basic_t      *chain;
+
+        /**
+         * Free-running write-index of the TX-Buffer when the chain was queued.
+         * The Bytes in front of it are transmitted before the chain.
+         */
+        uint8_t                         position;
+};
+
+
 // private function prototypes
 static void rxCallback(uint8_t b);
 static void txCallback(void);
+static void txSpan(void);
+static void txStart(void);
+static struct databuffer_basic_t *skipEmptySegments(struct databuffer_basic_t *segment);
+static void releaseChain(void);
 
 
 // data
-static volatile uint8_t  rxBuffer[SERIALCONSOLE_RX_BUFFERSIZE];
-static volatile uint16_t rxBufferReadIndex;
-static volatile uint16_t rxBufferSize;
-static volatile uint8_t  txBuffer[SERIALCONSOLE_TX_BUFFERSIZE];
-static volatile uint16_t txBufferReadIndex;
-static volatile uint16_t txBufferSize;
-static volatile bool     isTransmitting;
+static uint8_t             rxBufferData[SERIALCONSOLE_RX_BUFFERSIZE];
+static struct ringbuffer_t rxBuffer;
+static uint8_t             txBufferData[SERIALCONSOLE_TX_BUFFERSIZE];
+static struct ringbuffer_t txBuffer;
+static uint8_t             txSpanLength;
+static volatile bool       isTransmitting;
+static struct txChain_t    txChains[SERIALCONSOLE_TX_CHAINS];
+static volatile uint8_t    txChainsHead;
+static volatile uint8_t    txChainsTail;
+static struct databuffer_basic_t *txSegment;
 
 
 // public functions
 void serialConsole_init(void)
 {
+        ringbuffer_init(&rxBuffer, rxBufferData, SERIALCONSOLE_RX_BUFFERSIZE);
+        ringbuffer_init(&txBuffer, txBufferData, SERIALCONSOLE_TX_BUFFERSIZE);
+        txSpanLength = 0;
+        isTransmitting = false;
+        txChainsHead = 0;
+        txChainsTail = 0;
+        txSegment = NULL;
+        
         serialConsole_uart_init(SERIALCONSOLE_BAUDRATE);
         serialConsole_uart_setRxFinishedCallback(rxCallback);
         serialConsole_uart_setTxFinishedCallback(txCallback);
-        
-        rxBufferReadIndex = 0;
-        rxBufferSize      = 0;
-        txBufferReadIndex = 0;
-        txBufferSize      = 0;
-        isTransmitting = false;
 }
 
 uint16_t serialConsole_getRxByteCount(void)
 {
-        return rxBufferSize;
+        return ringbuffer_getCount(&rxBuffer);
 }
 
 uint8_t serialConsole_getRxByte(uint8_t *b)
 {
-        // check if bytes are available
-        if (rxBufferSize > 0) {
-                cli();
-                *b = rxBuffer[rxBufferReadIndex];
-                
-                // adjust rxReadIndex
-                rxBufferReadIndex = (rxBufferReadIndex + 1)
-                                    % SERIALCONSOLE_RX_BUFFERSIZE;
-                rxBufferSize--;
-                sei();
-                
-                return 1;
-        }
-        
-        return 0;
+        return ringbuffer_get(&rxBuffer, b) ? 1 : 0;
 }
 
 uint16_t serialConsole_getRxBytes(uint8_t *b, uint16_t size)
 {
-        uint16_t numberOfReadBytes = 0;
-        
-        // read bytes one by one from the buffer
-        while ((numberOfReadBytes < size) &&
-               (serialConsole_getRxByte(b++) != 0))
-                numberOfReadBytes++;
-        
-        return numberOfReadBytes;
+        return ringbuffer_read(&rxBuffer, b, size);
+}
+
+uint8_t serialConsole_getTxFree(void)
+{
+        return ringbuffer_getFree(&txBuffer);
 }
 
 void serialConsole_txByte(uint8_t b)
 {
-        if (isTransmitting) {
-                // save in buffer
-                if (txBufferSize < SERIALCONSOLE_TX_BUFFERSIZE) {
-                        cli();
-                        txBuffer[(txBufferReadIndex + txBufferSize)
-                                 % SERIALCONSOLE_TX_BUFFERSIZE] = b;
+        // the Byte is dropped if the TX-Buffer is full
+        if (ringbuffer_put(&txBuffer, b))
+                txStart();
+}
 
-                        // adjust txBufferSize
-                        txBufferSize++;
-                        sei();
-                }
-        } else {
-                // direct transmit
-                isTransmitting = true;
-                serialConsole_uart_txByte(b);
+void serialConsole_txBytes(const uint8_t *b, uint16_t length)
+{
+        uint16_t numberOfWrittenBytes;
+        
+        // copies as many bytes as fit, waits for the transmission otherwise
+        while (length > 0) {
+                numberOfWrittenBytes = serialConsole_txBytesNonBlocking(b,
+                                                                        length);
+                b += numberOfWrittenBytes;
+                length -= numberOfWrittenBytes;
         }
 }
 
-void serialConsole_txBytes(uint8_t *b, uint16_t length)
+uint16_t serialConsole_txBytesNonBlocking(const uint8_t *b, uint16_t length)
+{
+        uint16_t numberOfWrittenBytes;
+        
+        numberOfWrittenBytes = ringbuffer_write(&txBuffer, b, length);
+        if (numberOfWrittenBytes > 0)
+                txStart();
+        
+        return numberOfWrittenBytes;
+}
+
+void serialConsole_txBytesP(const uint8_t *b, uint16_t length)
 {
-        // transmits bytes one-by-one
+        uint8_t *span;
+        uint8_t spanLength;
+        
+        // copies the free spans, waits for the transmission otherwise
         while (length > 0) {
-                // wait until the buffer has space for the next byte
-                while (txBufferSize >= SERIALCONSOLE_TX_BUFFERSIZE);
+                spanLength = ringbuffer_getWriteSpan(&txBuffer, &span);
+                if (spanLength == 0)
+                        continue;
+                if (spanLength > length)
+                        spanLength = length;
+                memcpy_P(span, b, spanLength);
+                ringbuffer_commitWrite(&txBuffer, spanLength);
+                txStart();
                 
-                serialConsole_txByte(*b);
-                b++;
-                length--;
+                b += spanLength;
+                length -= spanLength;
         }
 }
 
+bool serialConsole_txChain(struct databuffer_basic_t *chain)
+{
+        struct databuffer_basic_t *segment;
+        struct txChain_t *txChain;
+        uint8_t head = txChainsHead;
+        
+        for (segment = chain; segment != NULL; segment = segment->next) {
+                if (databuffer_isProgmem(segment)) {
+                        // the UART cannot read the program-memory
+                        serialConsole_txDatabuffer(chain);
+                        databuffer_free(chain);
+                        return true;
+                }
+        }
+        
+        if ((uint8_t)(head - txChainsTail) >= SERIALCONSOLE_TX_CHAINS) {
+                databuffer_free(chain);
+                return false;
+        }
+        
+        txChain = &txChains[head & (SERIALCONSOLE_TX_CHAINS - 1)];
+        txChain->chain = chain;
+        txChain->position = txBuffer.head;
+        // the entry is written before the TX-Interrupt can see it
+        COMPILER_BARRIER();
+        txChainsHead = head + 1;
+        txStart();
+        
+        return true;
+}
+
 
 // private functions
 static void rxCallback(uint8_t b)
 {
-        if (rxBufferSize < SERIALCONSOLE_RX_BUFFERSIZE) {
-                rxBuffer[(rxBufferReadIndex + rxBufferSize)
-                         % SERIALCONSOLE_RX_BUFFERSIZE] = b;
-                
-                // adjust rxBufferSize
-                rxBufferSize++;
-        }
+        // the byte is dropped if the RX-Buffer is full
+        ringbuffer_put(&rxBuffer, b);
 }
 
 static void txCallback(void)
 {
-        // this function transmits one byte at a time
-        if (txBufferSize > 0) {
-                serialConsole_uart_txByte(txBuffer[txBufferReadIndex]);
-                
-                // adjust txReadIndex
-                txBufferReadIndex = (txBufferReadIndex + 1)
-                                    % SERIALCONSOLE_TX_BUFFERSIZE;
-                txBufferSize--;
+        if (txSegment != NULL) {
+                // the segment has been transmitted directly from the chain
+                txSegment = skipEmptySegments(txSegment->next);
+                if (txSegment == NULL)
+                        releaseChain();
         } else {
-                isTransmitting = false;
+                // the span has been transmitted, its space can be reused
+                ringbuffer_commitRead(&txBuffer, txSpanLength);
         }
+        txSpan();
+}
+
+static void txSpan(void)
+{
+        struct txChain_t *txChain;
+        uint8_t *span;
+        uint8_t numberOfBytesInFront;
+        
+        // the UART transmits the contiguous bytes without calling txCallback
+        while (txSegment == NULL) {
+                txSpanLength = ringbuffer_getReadSpan(&txBuffer, &span);
+                
+                if (txChainsHead != txChainsTail) {
+                        txChain = &txChains[txChainsTail &
+                                            (SERIALCONSOLE_TX_CHAINS - 1)];
+                        numberOfBytesInFront = txChain->position -
+                                               txBuffer.tail;
+                        
+                        if (numberOfBytesInFront == 0) {
+                                // the chain is next, empty chains are skipped
+                                txSegment = skipEmptySegments(txChain->chain);
+                                if (txSegment == NULL)
+                                        releaseChain();
+                                continue;
+                        }
+                        if (txSpanLength > numberOfBytesInFront)
+                                txSpanLength = numberOfBytesInFront;
+                }
+                
+                if (txSpanLength > 0)
+                        serialConsole_uart_txBuffer(span, txSpanLength);
+                else
+                        isTransmitting = false;
+                return;
+        }
+        
+        serialConsole_uart_txBuffer(txSegment->data, txSegment->length);
+}
+
+static void txStart(void)
+{
+        // No TX-interrupt occurs while isTransmitting is false, so txCallback
+        // cannot interfere. If it has just ended the transmission the new
+        // bytes are started here, otherwise it has already sent them.
+        if (!isTransmitting) {
+                isTransmitting = true;
+                txSpan();
+        }
+}
+
+static struct databuffer_basic_t *skipEmptySegments(struct databuffer_basic_t *segment)
+{
+        while ((segment != NULL) && (segment->length == 0))
+                segment = segment->next;
+        
+        return segment;
+}
+
+static void releaseChain(void)
+{
+        struct txChain_t *txChain;
+        
+        // the chain has been transmitted, the entry can be reused
+        txChain = &txChains[txChainsTail & (SERIALCONSOLE_TX_CHAINS - 1)];
+        databuffer_free(txChain->chain);
+        txChain->chain = NULL;
+        txChainsTail++;
 }
 
 
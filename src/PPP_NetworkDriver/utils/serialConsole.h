@@ -1,12 +1,24 @@
 /**
  *******************************************************************************
  * @file        serialConsole.h
- * @version     0.0.3
- * @date        2017.09.25
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Header-file to handle input/output of serial data (strings,
                 etc.).
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# Added serialConsole_txBytesP, DataBuffers may be
+ *                         located in the program-memory. (MS)
+ *                      -# Corrected the description of serialConsole_txByte.
+ *                         (MS)
+ *                      -# Added serialConsole_getTxFree. (MS)
+ *                      -# Added serialConsole_txBytesNonBlocking,
+ *                         serialConsole_txBytes takes constant Bytes. (MS)
+ *                      -# Added serialConsole_txStringP and
+ *                         serialConsole_txLiteralP. (MS)
+ *                      -# Added serialConsole_txChain. (MS)
+ *
  * @since       V0.0.3, 2017.09.25:
  *                      -# Changed from inline to macro. (MS)
  *                      -# No typedefs for struct and enum. (MS)
@@ -99,29 +111,81 @@ uint8_t  serialConsole_getRxByte(uint8_t *b);
  */
 uint16_t serialConsole_getRxBytes(uint8_t *b, uint16_t size);
 
+/**
+ *  Returns the number of Bytes that can be transmitted without waiting.
+ *  @return     Number of free Bytes in the TX-Buffer.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       None.
+ */
+uint8_t serialConsole_getTxFree(void);
+
 /**
  *  Transmits a Byte. If there is a transmission in progress the Byte will be
- *  put at the end of the TX-Buffer. If the TX-Buffer is full it will wait until
- *  there is enough space to append the Byte.
+ *  put at the end of the TX-Buffer. If the TX-Buffer is full the Byte is
+ *  dropped.
  *  @param      b: Byte to transmit.
  *  @return     None.
- *  @pre        The function serialConsole_init had been called.
+ *  @pre        The function serialConsole_init had been called. The TX-Buffer
+ *              has a single producer, the transmitting functions must not be
+ *              called by an interrupt service routine and the main loop at
+ *              the same time.
  *  @post       The Byte had ben put into the TX-Buffer (hardware or software).
  */
 void serialConsole_txByte(uint8_t b);
 
 /**
- *  Transmits a number of Bytes. It will transmit them Byte-after-Byte.       @n
- *  If there is a transmission in progress the next Byte will be put at the end
- *  of the TX-Buffer. If the TX-Buffer is full it will wait until there is
- *  enough space to append the Byte.
+ *  Transmits a number of Bytes. They are copied into the TX-Buffer in
+ *  contiguous blocks. If the TX-Buffer is full it will wait until the
+ *  transmission has made space for the remaining Bytes.
+ *  @param      b: Pointer to an Array holding the Bytes to transmit.
+ *  @param      length: Number of Bytes to transmit.
+ *  @return     None.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       The Bytes had ben put into the TX-Buffer (hardware or software).
+ */
+void serialConsole_txBytes(const uint8_t *b, uint16_t length);
+
+/**
+ *  Puts as many Bytes into the TX-Buffer as fit without waiting. They are
+ *  copied in at most two contiguous blocks.
  *  @param      b: Pointer to an Array holding the Bytes to transmit.
  *  @param      length: Number of Bytes to transmit.
+ *  @return     Number of accepted Bytes, the remaining Bytes have to be
+ *              transmitted by a later call.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       The accepted Bytes had been put into the TX-Buffer.
+ *  @see        serialConsole_txBytes
+ */
+uint16_t serialConsole_txBytesNonBlocking(const uint8_t *b, uint16_t length);
+
+/**
+ *  Transmits a number of Bytes that are located in the program-memory.
+ *  @param      b: Pointer to an Array in the program-memory holding the Bytes
+ *              to transmit.
+ *  @param      length: Number of Bytes to transmit.
  *  @return     None.
  *  @pre        The function serialConsole_init had been called.
  *  @post       The Bytes had ben put into the TX-Buffer (hardware or software).
+ *  @see        serialConsole_txBytes
  */
-void serialConsole_txBytes(uint8_t *b, uint16_t length);
+void serialConsole_txBytesP(const uint8_t *b, uint16_t length);
+
+/**
+ *  Transmits a DataBuffer-Chain without copying it. The chain is queued
+ *  behind the Bytes of the TX-Buffer and the TX-Interrupt transmits its
+ *  segments directly, Bytes that are put into the TX-Buffer afterwards
+ *  follow the chain. The function does not wait.                             @n
+ *  Chains with segments in the program-memory are copied into the TX-Buffer
+ *  (see serialConsole_txDatabuffer), which waits if it is full.
+ *  @param      chain: First DataBuffer-Element of the chain, this module
+ *              takes the ownership.
+ *  @return     False if SERIALCONSOLE_TX_CHAINS chains are queued already,
+ *              the chain had been dropped then.
+ *  @pre        The function serialConsole_init had been called. The data of
+ *              the chain is not changed until it had been transmitted.
+ *  @post       The chain is freed after its transmission.
+ */
+bool serialConsole_txChain(struct databuffer_basic_t *chain);
 
 /**
  *  Transmits a String (zero-terminated Character-Array).                     @n
@@ -135,12 +199,44 @@ void serialConsole_txBytes(uint8_t *b, uint16_t length);
  *  @see        serialConsole_txBytes
  */
 #define serialConsole_txString(_s_)     \
-        serialConsole_txBytes((uint8_t *)_s_, strlen(_s_))
+        serialConsole_txBytes((const uint8_t *)_s_, strlen(_s_))
+
+/**
+ *  Transmits a String that is located in the program-memory.                 @n
+ *  This function will block until the last character had been put into the
+ *  TX-Buffer.
+ *  @param      _s_: Pointer to a zero-terminated Character-Array in the
+ *              program-memory (PGM_P).
+ *  @return     None.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       The String had ben put into the TX-Buffer (hardware or
+ *              software).
+ *  @see        serialConsole_txBytesP
+ */
+#define serialConsole_txStringP(_s_)    \
+        serialConsole_txBytesP((const uint8_t *)(_s_), strlen_P(_s_))
+
+/**
+ *  Transmits a String-Literal. The Literal is stored in the program-memory
+ *  only (PSTR) and its length is known at compile-time, so neither RAM nor
+ *  strlen is needed.                                                         @n
+ *  This function will block until the last character had been put into the
+ *  TX-Buffer.
+ *  @param      _s_: String-Literal, e.g. "PPPState_Establish\n".
+ *  @return     None.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       The String had ben put into the TX-Buffer (hardware or
+ *              software).
+ *  @see        serialConsole_txBytesP
+ */
+#define serialConsole_txLiteralP(_s_)   \
+        serialConsole_txBytesP((const uint8_t *)PSTR(_s_), sizeof(_s_) - 1)
 
 /**
  *  Transmits a DataBuffer.                                                   @n
  *  This function will block until the last Byte had been put into the
- *  TX-Buffer.
+ *  TX-Buffer. The chain stays with the caller, serialConsole_txChain
+ *  transmits an owned chain without copying.
  *  @param      chain: Pointer to the first Element of the DataBuffer-Chain.
  *  @return     None.
  *  @pre        The function serialConsole_init had been called.
@@ -151,7 +247,10 @@ void serialConsole_txBytes(uint8_t *b, uint16_t length);
 inline void serialConsole_txDatabuffer(struct databuffer_basic_t *chain)
 {
         while (chain != NULL) {
-                serialConsole_txBytes(chain->data, chain->length);
+                if (databuffer_isProgmem(chain))
+                        serialConsole_txBytesP(chain->data, chain->length);
+                else
+                        serialConsole_txBytes(chain->data, chain->length);
                 chain = chain->next;
         }
 }
@@ -1,12 +1,16 @@
 /**
  *******************************************************************************
  * @file        serialConsole_cfg.h
- * @version     0.0.2
- * @date        2017.09.12
+ * @version     0.0.4
+ * @date        2026.10.19
  * @author      Michael Strosche (TheCross)
  * @brief       Config-file to handle input/output of serial data (strings,
  *              etc.).
  *
+ * @since       V0.0.4, 2026.10.19:
+ *                      -# The buffer-sizes must be a power of two. (MS)
+ *                      -# Added SERIALCONSOLE_TX_CHAINS. (MS)
+ *
  * @since       V0.0.2, 2017.09.12:
  *                      -# Modified doxygen-comments. (MS)
  *
@@ -46,15 +50,24 @@
 #define _SERIALCONSOLE_CFG_H_
 
 /**
- *  Size of the RX-Buffer in Bytes.
+ *  Size of the RX-Buffer in Bytes.                                           @n
+ *  Must be a power of two from 2 to 128!
  */
 #define SERIALCONSOLE_RX_BUFFERSIZE (64)
 
 /**
- *  Size of the TX-Buffer in Bytes.
+ *  Size of the TX-Buffer in Bytes.                                           @n
+ *  Must be a power of two from 2 to 128!
  */
 #define SERIALCONSOLE_TX_BUFFERSIZE (64)
 
+/**
+ *  Maximum number of DataBuffer-Chains that are queued for the transmission
+ *  (see serialConsole_txChain).                                              @n
+ *  Must be a power of two from 2 to 128!
+ */
+#define SERIALCONSOLE_TX_CHAINS     (4)
+
 /**
  *  Baudrate of the UART-Driver.
  */
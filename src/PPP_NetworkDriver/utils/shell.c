@@ -0,0 +1,686 @@
+/**
+ *******************************************************************************
+ * @file        shell.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the console shell.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "shell.h"
+#include "shell_cfg.h"
+#include "databuffer.h"
+#include "capture.h"
+#include "eventLog.h"
+#include "scheduler.h"
+#include "serialConsole.h"
+#include "serialConsole_cfg.h"
+#include "timebase.h"
+
+#include "..\\system.h"
+#include "..\\driver\\net\\PPP.h"
+#include "..\\driver\\net\\LCP.h"
+#include "..\\driver\\net\\IPV4.h"
+
+#include <string.h>
+#include <avr/pgmspace.h>
+
+#if SHELL_OUTPUT_MAX > SERIALCONSOLE_TX_BUFFERSIZE
+        #error "SHELL_OUTPUT_MAX does not fit into the TX-Buffer of the serial console"
+#endif
+
+#define SHELL_NAME_MAX                  (6)
+#define SHELL_HELP_MAX                  (28)
+
+/**
+ *  Number of decimal digits of the largest value of an unsigned counter.
+ */
+#define SHELL_DIGITS(_counter_)                                         \
+        ((sizeof(_counter_) == 1) ? 3 : ((sizeof(_counter_) == 2) ? 5 : 10))
+
+/**
+ *  Fails the compilation if a line of the given worst-case length does not
+ *  fit into the output-buffer, appendNumber would cut the number.
+ */
+#define SHELL_CHECK_LINE(_length_)                                      \
+        (void)BUILD_BUG_ON_ZERO((_length_) > SHELL_OUTPUT_MAX - 1)
+
+// type-definitions
+/**
+ *  A command writes one line of its output into the output-buffer per call.
+ *  step counts the calls from 0, it returns true if more lines follow.
+ */
+struct shell_command_t {
+        char    name[SHELL_NAME_MAX];
+        char    help[SHELL_HELP_MAX];
+        bool    (*handler)(uint8_t step);
+};
+
+// private function prototypes
+static void execute(void);
+static void prompt(void);
+static bool cmdHelp(uint8_t step);
+static bool cmdState(uint8_t step);
+static bool cmdStats(uint8_t step);
+static bool cmdPools(uint8_t step);
+static bool cmdClear(uint8_t step);
+static bool cmdMru(uint8_t step);
+static bool cmdIp(uint8_t step);
+static bool cmdLog(uint8_t step);
+static bool cmdEcho(uint8_t step);
+static bool cmdPcap(uint8_t step);
+static bool cmdUart(uint8_t step);
+static bool cmdUnknown(uint8_t step);
+static void appendP(PGM_P s);
+static void appendNumber(uint32_t value);
+static void appendIP(const uint8_t ip[4]);
+static void appendResult(bool isValid);
+static void appendFlag(bool isSet);
+static bool parseNumber(const char **s, uint32_t max, uint32_t *value);
+
+// private data
+static const struct shell_command_t commands[] PROGMEM = {
+        {"help",  "list the commands",            cmdHelp},
+        {"state", "show the link-state",          cmdState},
+        {"stats", "show the counters",            cmdStats},
+        {"pools", "show the DataBuffer-Pools",    cmdPools},
+        {"clear", "reset the counters",           cmdClear},
+        {"mru",   "<n>: set the MRU",             cmdMru},
+        {"ip",    "<a.b.c.d>: set the local IP",  cmdIp},
+        {"log",   "<0-4>: set the log-level",     cmdLog},
+        {"echo",  "send an LCP-Echo-Request",     cmdEcho},
+        {"pcap",  "<0|1>: capture the frames",    cmdPcap},
+        {"uart",  "show the UART of PPP",         cmdUart},
+};
+
+static char             line[SHELL_LINE_MAX + 1];
+static uint8_t          lineLength;
+static const char       *argument;
+static bool             (*command)(uint8_t step);
+static uint8_t          step;
+static char             output[SHELL_OUTPUT_MAX];
+static uint8_t          outputLength;
+static uint8_t          lastCharacter;
+static uint32_t         uartTxBytes;
+static uint32_t         uartMicros;
+
+// public functions
+void shell_init(void)
+{
+        lineLength = 0;
+        command = NULL;
+        lastCharacter = 0;
+
+        prompt();
+}
+
+void shell_loop(void)
+{
+        uint8_t c;
+
+        if (command != NULL) {
+                // one line per call, only if it fits completely
+                if (serialConsole_getTxFree() < SHELL_OUTPUT_MAX)
+                        return;
+
+                outputLength = 0;
+                if (!command(step++))
+                        command = NULL;
+                output[outputLength++] = '\n';
+                serialConsole_txBytes((const uint8_t *)output, outputLength);
+
+                if (command == NULL)
+                        prompt();
+                return;
+        }
+
+        while (serialConsole_getRxByte(&c) != 0) {
+                if ((c == '\r') || (c == '\n')) {
+                        // CR+LF is a single line-ending
+                        if ((c == '\n') && (lastCharacter == '\r')) {
+                                lastCharacter = c;
+                                continue;
+                        }
+                        lastCharacter = c;
+#ifdef SHELL_ECHO
+                        serialConsole_txByte('\n');
+#endif
+                        execute();
+                        return;
+                }
+                lastCharacter = c;
+
+                if ((c == '\b') || (c == 0x7F)) {
+                        if (lineLength > 0) {
+                                lineLength--;
+#ifdef SHELL_ECHO
+                                serialConsole_txLiteralP("\b \b");
+#endif
+                        }
+                } else if ((c >= ' ') && (c < 0x7F) &&
+                           (lineLength < SHELL_LINE_MAX)) {
+                        line[lineLength++] = c;
+#ifdef SHELL_ECHO
+                        serialConsole_txByte(c);
+#endif
+                }
+        }
+}
+
+// private functions
+static void execute(void)
+{
+        struct shell_command_t entry;
+        char *name = line;
+        uint8_t i;
+
+        line[lineLength] = '\0';
+        lineLength = 0;
+
+        // split the line into the name and the argument
+        while (*name == ' ')
+                name++;
+        if (*name == '\0') {
+                prompt();
+                return;
+        }
+        for (i = 0; (name[i] != ' ') && (name[i] != '\0'); i++)
+                ;
+        argument = &name[i];
+        if (name[i] != '\0') {
+                name[i] = '\0';
+                argument++;
+                while (*argument == ' ')
+                        argument++;
+        }
+
+        command = cmdUnknown;
+        for (i = 0; i < ARRAY_SIZE(commands); i++) {
+                if (strcmp_P(name, commands[i].name) == 0) {
+                        memcpy_P(&entry, &commands[i], sizeof(entry));
+                        command = entry.handler;
+                        break;
+                }
+        }
+        step = 0;
+}
+
+static void prompt(void)
+{
+        serialConsole_txLiteralP("> ");
+}
+
+static bool cmdHelp(uint8_t index)
+{
+        uint8_t length;
+
+        appendP(commands[index].name);
+        for (length = strlen_P(commands[index].name);
+             length < SHELL_NAME_MAX;
+             length++)
+                output[outputLength++] = ' ';
+        appendP(commands[index].help);
+
+        return (size_t)index + 1 < ARRAY_SIZE(commands);
+}
+
+static bool cmdState(uint8_t index)
+{
+        static const char stateNames[][13] PROGMEM = {
+                "Dead", "Establish", "Authenticate", "Network", "Terminate"
+        };
+        uint16_t error;
+        ipv4_t ip;
+
+        SHELL_CHECK_LINE(sizeof("baud  , error /1000") - 1 +
+                         SHELL_DIGITS(net_PPP_getBaudrate(&error)) +
+                         SHELL_DIGITS(error));
+
+        switch (index) {
+        case 0:
+                appendP(PSTR("ppp   "));
+                appendP(stateNames[net_PPP_getState()]);
+                break;
+
+        case 1:
+                appendP(PSTR("lcp   host "));
+                appendFlag(net_LCP_getState() &
+                           NET_LCP_STATE__HOST_CONFIGURED);
+                appendP(PSTR(", client "));
+                appendFlag(net_LCP_getState() &
+                           NET_LCP_STATE__CLIENT_CONFIGURED);
+                break;
+
+        case 2:
+                appendP(PSTR("mru   "));
+                appendNumber(net_LCP_getMru());
+                break;
+
+        case 3:
+                appendP(PSTR("ip    "));
+                ip = net_IPV4_getLocalIP();
+                appendIP(ip.single);
+                break;
+
+        case 4:
+                appendP(PSTR("baud  "));
+                appendNumber(net_PPP_getBaudrate(&error));
+                appendP(PSTR(", error "));
+                appendNumber(error);
+                appendP(PSTR("/1000"));
+                break;
+
+        case 5:
+                appendP(PSTR("log   "));
+                appendNumber(eventLog_level);
+                break;
+
+        default:
+                appendP(PSTR("pcap  "));
+                appendFlag(capture_isEnabled());
+                return false;
+        }
+
+        return true;
+}
+
+static bool cmdStats(uint8_t index)
+{
+        struct net_PPP_statistics_t ppp;
+        struct net_LCP_statistics_t lcp;
+        struct net_IPV4_statistics_t ipv4;
+        struct capture_statistics_t pcap;
+        struct scheduler_statistics_t scheduler;
+
+        // the longest line of each group of counters
+        SHELL_CHECK_LINE(sizeof("ppp   queue , tx , drop ") - 1 +
+                         SHELL_DIGITS(ppp.rxQueueDrops) +
+                         SHELL_DIGITS(ppp.txFrames) +
+                         SHELL_DIGITS(ppp.txDrops));
+        SHELL_CHECK_LINE(sizeof("ppp   rx , fcs , nomem ") - 1 +
+                         SHELL_DIGITS(ppp.rxFrames) +
+                         SHELL_DIGITS(ppp.rxFcsErrors) +
+                         SHELL_DIGITS(ppp.rxNoMemory));
+        SHELL_CHECK_LINE(sizeof("echo  tx , reply , rx ") - 1 +
+                         SHELL_DIGITS(lcp.echoRequestsSent) +
+                         SHELL_DIGITS(lcp.echoRepliesReceived) +
+                         SHELL_DIGITS(lcp.echoRequestsReceived));
+        SHELL_CHECK_LINE(sizeof("lcp   rx , tx ") - 1 +
+                         SHELL_DIGITS(lcp.rxMessages) +
+                         SHELL_DIGITS(lcp.txMessages));
+        SHELL_CHECK_LINE(sizeof("ipv4  rx , unknown , other ") - 1 +
+                         SHELL_DIGITS(ipv4.rxPackets) +
+                         SHELL_DIGITS(ipv4.rxUnknownProtocol) +
+                         SHELL_DIGITS(ipv4.rxNotMyIP));
+        SHELL_CHECK_LINE(sizeof("ipv4  checksum , header ") - 1 +
+                         SHELL_DIGITS(ipv4.rxChecksumErrors) +
+                         SHELL_DIGITS(ipv4.rxHeaderErrors));
+        SHELL_CHECK_LINE(sizeof("pcap  frames , drop ") - 1 +
+                         SHELL_DIGITS(pcap.frames) +
+                         SHELL_DIGITS(pcap.drops));
+        SHELL_CHECK_LINE(sizeof("sched events , sleeps ") - 1 +
+                         SHELL_DIGITS(scheduler.events) +
+                         SHELL_DIGITS(scheduler.sleeps));
+        SHELL_CHECK_LINE(sizeof("wake  last , max  us") - 1 +
+                         SHELL_DIGITS(scheduler.latencyLast) +
+                         SHELL_DIGITS(scheduler.latencyMax));
+
+        switch (index) {
+        case 0:
+                net_PPP_getStatistics(&ppp);
+                appendP(PSTR("ppp   rx "));
+                appendNumber(ppp.rxFrames);
+                appendP(PSTR(", fcs "));
+                appendNumber(ppp.rxFcsErrors);
+                appendP(PSTR(", nomem "));
+                appendNumber(ppp.rxNoMemory);
+                break;
+
+        case 1:
+                net_PPP_getStatistics(&ppp);
+                appendP(PSTR("ppp   queue "));
+                appendNumber(ppp.rxQueueDrops);
+                appendP(PSTR(", tx "));
+                appendNumber(ppp.txFrames);
+                appendP(PSTR(", drop "));
+                appendNumber(ppp.txDrops);
+                break;
+
+        case 2:
+                net_LCP_getStatistics(&lcp);
+                appendP(PSTR("lcp   rx "));
+                appendNumber(lcp.rxMessages);
+                appendP(PSTR(", tx "));
+                appendNumber(lcp.txMessages);
+                break;
+
+        case 3:
+                net_LCP_getStatistics(&lcp);
+                appendP(PSTR("echo  tx "));
+                appendNumber(lcp.echoRequestsSent);
+                appendP(PSTR(", reply "));
+                appendNumber(lcp.echoRepliesReceived);
+                appendP(PSTR(", rx "));
+                appendNumber(lcp.echoRequestsReceived);
+                break;
+
+        case 4:
+                net_IPV4_getStatistics(&ipv4);
+                appendP(PSTR("ipv4  rx "));
+                appendNumber(ipv4.rxPackets);
+                appendP(PSTR(", unknown "));
+                appendNumber(ipv4.rxUnknownProtocol);
+                appendP(PSTR(", other "));
+                appendNumber(ipv4.rxNotMyIP);
+                break;
+
+        case 5:
+                net_IPV4_getStatistics(&ipv4);
+                appendP(PSTR("ipv4  checksum "));
+                appendNumber(ipv4.rxChecksumErrors);
+                appendP(PSTR(", header "));
+                appendNumber(ipv4.rxHeaderErrors);
+                break;
+
+        case 6:
+                capture_getStatistics(&pcap);
+                appendP(PSTR("pcap  frames "));
+                appendNumber(pcap.frames);
+                appendP(PSTR(", drop "));
+                appendNumber(pcap.drops);
+                break;
+
+        case 7:
+                scheduler_getStatistics(&scheduler);
+                appendP(PSTR("sched events "));
+                appendNumber(scheduler.events);
+                appendP(PSTR(", sleeps "));
+                appendNumber(scheduler.sleeps);
+                break;
+
+        default:
+                // the wake-up latency in microseconds
+                scheduler_getStatistics(&scheduler);
+                appendP(PSTR("wake  last "));
+                appendNumber(scheduler.latencyLast);
+                appendP(PSTR(", max "));
+                appendNumber(scheduler.latencyMax);
+                appendP(PSTR(" us"));
+                return false;
+        }
+
+        return true;
+}
+
+static bool cmdPools(uint8_t index)
+{
+        static const char poolNames[][7] PROGMEM = {
+                "seg   ", "small ", "large "
+        };
+        struct mempool_statistics_t statistics;
+
+        SHELL_CHECK_LINE(sizeof(poolNames[0]) - 1 + sizeof("/, , ") - 1 +
+                         SHELL_DIGITS(statistics.numberOfUsedBlocks) +
+                         SHELL_DIGITS(statistics.numberOfBlocks) +
+                         SHELL_DIGITS(statistics.highWaterMark) +
+                         SHELL_DIGITS(statistics.allocFailures));
+
+        if (index == 0) {
+                appendP(PSTR("pool  used/total, max, fail"));
+                return true;
+        }
+        index--;
+
+        databuffer_getPoolStatistics((enum databuffer_pool_e)index,
+                                     &statistics);
+        appendP(poolNames[index]);
+        appendNumber(statistics.numberOfUsedBlocks);
+        output[outputLength++] = '/';
+        appendNumber(statistics.numberOfBlocks);
+        appendP(PSTR(", "));
+        appendNumber(statistics.highWaterMark);
+        appendP(PSTR(", "));
+        appendNumber(statistics.allocFailures);
+
+        return index < DATABUFFER_POOL_LARGEBLOCK;
+}
+
+static bool cmdClear(uint8_t index)
+{
+        UNUSED_ARG(index);
+
+        net_PPP_resetStatistics();
+        net_LCP_resetStatistics();
+        net_IPV4_resetStatistics();
+        capture_resetStatistics();
+        scheduler_resetStatistics();
+        appendResult(true);
+
+        return false;
+}
+
+static bool cmdMru(uint8_t index)
+{
+        uint32_t value;
+
+        UNUSED_ARG(index);
+
+        // the new MRU is requested by the next Configure-Request
+        appendResult(parseNumber(&argument, UINT16_MAX, &value) &&
+                     (*argument == '\0') &&
+                     net_LCP_setMru((uint16_t)value));
+
+        return false;
+}
+
+static bool cmdIp(uint8_t index)
+{
+        uint8_t ip[4];
+        uint32_t value;
+        uint8_t i;
+        bool isValid = true;
+
+        UNUSED_ARG(index);
+
+        for (i = 0; isValid && (i < 4); i++) {
+                isValid = parseNumber(&argument, UINT8_MAX, &value) &&
+                          (*argument == ((i < 3) ? '.' : '\0'));
+                ip[i] = (uint8_t)value;
+                argument++;
+        }
+        if (isValid)
+                net_IPV4_setLocalIP(ip);
+        appendResult(isValid);
+
+        return false;
+}
+
+static bool cmdLog(uint8_t index)
+{
+        uint32_t value;
+
+        UNUSED_ARG(index);
+
+        appendResult(parseNumber(&argument, EVENTLOG_LEVEL_DEBUG, &value) &&
+                     (*argument == '\0') &&
+                     eventLog_setLevel((uint8_t)value));
+
+        return false;
+}
+
+static bool cmdEcho(uint8_t index)
+{
+        UNUSED_ARG(index);
+
+        // the reply is counted by the statistics
+        appendResult(net_LCP_sendEchoRequest());
+
+        return false;
+}
+
+static bool cmdPcap(uint8_t index)
+{
+        uint32_t value;
+        bool isValid;
+
+        UNUSED_ARG(index);
+
+        isValid = parseNumber(&argument, 1, &value) && (*argument == '\0');
+        if (isValid)
+                capture_setEnabled(value != 0);
+        appendResult(isValid);
+
+        return false;
+}
+
+static bool cmdUart(uint8_t index)
+{
+        uint16_t rxCycles;
+        uint16_t txCycles;
+        uint32_t txBytes;
+        uint32_t micros;
+        uint32_t bytes;
+
+        SHELL_CHECK_LINE(sizeof("isr   rx , tx  cycles") - 1 +
+                         SHELL_DIGITS(rxCycles) + SHELL_DIGITS(txCycles));
+        SHELL_CHECK_LINE(sizeof("tx     Bytes,  Bytes/s") - 1 +
+                         SHELL_DIGITS(bytes) + SHELL_DIGITS(bytes));
+
+        if (index == 0) {
+                // the worst-case since the last call, without prologue and
+                // epilogue
+                net_PPP_getUartIsrCycles(&rxCycles, &txCycles);
+                appendP(PSTR("isr   rx "));
+                appendNumber(rxCycles);
+                appendP(PSTR(", tx "));
+                appendNumber(txCycles);
+                appendP(PSTR(" cycles"));
+                return true;
+        }
+
+        // the throughput since the last call in steps of 10 ms, the Bytes
+        // overflow after 42 MB and the microseconds after 71 minutes
+        txBytes = net_PPP_getUartTxByteCount();
+        micros = timebase_getMicros();
+        bytes = txBytes - uartTxBytes;
+        appendP(PSTR("tx    "));
+        appendNumber(bytes);
+        appendP(PSTR(" Bytes, "));
+        appendNumber((micros - uartMicros >= 10000) ?
+                     bytes * 100 / ((micros - uartMicros) / 10000) : 0);
+        appendP(PSTR(" Bytes/s"));
+        uartTxBytes = txBytes;
+        uartMicros = micros;
+
+        return false;
+}
+
+static bool cmdUnknown(uint8_t index)
+{
+        UNUSED_ARG(index);
+
+        appendP(PSTR("unknown command, see help"));
+
+        return false;
+}
+
+static void appendP(PGM_P s)
+{
+        uint8_t length = strlen_P(s);
+
+        if (length > SHELL_OUTPUT_MAX - 1 - outputLength)
+                length = SHELL_OUTPUT_MAX - 1 - outputLength;
+        memcpy_P(&output[outputLength], s, length);
+        outputLength += length;
+}
+
+static void appendNumber(uint32_t value)
+{
+        char digits[10];
+        uint8_t count = 0;
+
+        do {
+                digits[count++] = '0' + (value % 10);
+                value /= 10;
+        } while (value != 0);
+
+        while ((count > 0) && (outputLength < SHELL_OUTPUT_MAX - 1))
+                output[outputLength++] = digits[--count];
+}
+
+static void appendIP(const uint8_t ip[4])
+{
+        uint8_t i;
+
+        for (i = 0; i < 4; i++) {
+                if (i != 0)
+                        output[outputLength++] = '.';
+                appendNumber(ip[i]);
+        }
+}
+
+static void appendResult(bool isValid)
+{
+        if (isValid)
+                appendP(PSTR("ok"));
+        else
+                appendP(PSTR("failed"));
+}
+
+static void appendFlag(bool isSet)
+{
+        if (isSet)
+                appendP(PSTR("yes"));
+        else
+                appendP(PSTR("no"));
+}
+
+static bool parseNumber(const char **s, uint32_t max, uint32_t *value)
+{
+        const char *p = *s;
+
+        *value = 0;
+        while ((*p >= '0') && (*p <= '9')) {
+                *value = *value * 10 + (*p - '0');
+                if (*value > max)
+                        return false;
+                p++;
+        }
+
+        if (p == *s)
+                return false;
+
+        *s = p;
+        return true;
+}
@@ -0,0 +1,78 @@
+/**
+ *******************************************************************************
+ * @file        shell.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the console shell. It reads command-lines from
+ *              the serial console and shows the state and the counters of
+ *              the network-modules, the occupancy of the DataBuffer-Pools,
+ *              and sets the MRU, the IP-address and the log-level at
+ *              run-time. Enter "help" for the list of the commands.          @n
+ *              shell_loop never waits: a line of the output is only
+ *              formatted when the TX-Buffer of the serial console has room
+ *              for it, the rest follows in the next calls.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _SHELL_H_
+#define _SHELL_H_
+
+#include "..\\system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Initializes the console shell and transmits the prompt.
+ *  @return     None.
+ *  @pre        The function serialConsole_init had been called.
+ *  @post       The shell is initialized.
+ */
+void shell_init(void);
+
+/**
+ *  Reads the received Characters and executes a completed command-line. It
+ *  transmits at most one line of the output per call.
+ *  @return     None.
+ *  @pre        The function shell_init had been called.
+ *  @post       None.
+ */
+void shell_loop(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _SHELL_H_ */
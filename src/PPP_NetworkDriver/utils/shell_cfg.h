@@ -0,0 +1,64 @@
+/**
+ *******************************************************************************
+ * @file        shell_cfg.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Config-file of the console shell.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _SHELL_CFG_H_
+#define _SHELL_CFG_H_
+
+/**
+ *  Maximum length of an input line in Characters, the further Characters are
+ *  ignored.
+ */
+#define SHELL_LINE_MAX (32)
+
+/**
+ *  Maximum length of an output line in Characters. A line is only formatted
+ *  when the TX-Buffer of the serial console has room for it. The shell fails
+ *  to compile if the worst-case line of a command does not fit.              @n
+ *  Must be less or equal to SERIALCONSOLE_TX_BUFFERSIZE!
+ */
+#define SHELL_OUTPUT_MAX (48)
+
+/**
+ *  Uncomment this Define to echo the received Characters, e.g. for a
+ *  terminal-program without local echo.
+ */
+#define SHELL_ECHO
+
+#endif /* _SHELL_CFG_H_ */
@@ -0,0 +1,105 @@
+/**
+ *******************************************************************************
+ * @file        timebase.c
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Source-file of the time-base.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#include "timebase.h"
+#include "cycleCounter.h"
+
+#include "..\\system.h"
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#if (TIMEBASE_CYCLES_PER_US == 0) || \
+    ((65536UL % TIMEBASE_CYCLES_PER_US) != 0)
+        #error "F_CPU must be 1, 2, 4, 8 or 16 MHz for the time-base"
+#endif
+
+#define TIMEBASE_TIMSK  CONCAT2(TIMSK, CYCLECOUNTER_TIMER)
+#define TIMEBASE_TIFR   CONCAT2(TIFR, CYCLECOUNTER_TIMER)
+#define TIMEBASE_TOIE   CONCAT2(TOIE, CYCLECOUNTER_TIMER)
+#define TIMEBASE_TOV    CONCAT2(TOV, CYCLECOUNTER_TIMER)
+
+// data
+static volatile uint32_t overflowMicros;
+static void (*volatile overflowCallback)(void);
+
+// public functions
+void timebase_init(void)
+{
+        overflowMicros = 0;
+        overflowCallback = NULL;
+
+        TIMEBASE_TIFR = BV(TIMEBASE_TOV);
+        cycleCounter_init();
+        TIMEBASE_TIMSK |= BV(TIMEBASE_TOIE);
+}
+
+uint32_t timebase_getMicros(void)
+{
+        uint32_t micros;
+        uint16_t cycles;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                micros = overflowMicros;
+                cycles = cycleCounter_read();
+
+                // the overflow has happened but not been served yet
+                if ((TIMEBASE_TIFR & BV(TIMEBASE_TOV)) && (cycles < 0x8000))
+                        micros += TIMEBASE_US_PER_OVERFLOW;
+        }
+
+        return micros + cycles / TIMEBASE_CYCLES_PER_US;
+}
+
+void timebase_setOverflowCallback(void (*callback)(void))
+{
+        // the pointer is written in two instructions
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                overflowCallback = callback;
+        }
+}
+
+// interrupt service routines
+ISR(CONCAT3(TIMER, CYCLECOUNTER_TIMER, _OVF_vect))
+{
+        overflowMicros += TIMEBASE_US_PER_OVERFLOW;
+        if (overflowCallback != NULL)
+                overflowCallback();
+}
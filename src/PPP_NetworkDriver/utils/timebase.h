@@ -0,0 +1,97 @@
+/**
+ *******************************************************************************
+ * @file        timebase.h
+ * @version     0.0.1
+ * @date        2026.10.19
+ * @author      Michael Strosche (TheCross)
+ * @brief       Header-file of the time-base. It extends the Timer of the
+ *              cycle-counter (see cycleCounter_cfg.h) by its overflow
+ *              interrupt to a clock in microseconds, e.g. for the
+ *              timestamps of captured frames. The clock overflows every
+ *              71.6 minutes. The overflow interrupt can call a function
+ *              every TIMEBASE_US_PER_OVERFLOW microseconds, e.g. as the tick
+ *              of the scheduler.
+ *
+ * @since       V0.0.1, 2026.10.19:
+ *                      -# Initial version. (MS)
+ *
+ * @copyright   The MIT License (MIT)                                         @n
+ *                                                                            @n
+ *              Copyright (c) 2017 Michael Strosche                           @n
+ *                                                                            @n
+ *              Permission is hereby granted, free of charge, to any person
+ *              obtaining a copy of this software and associated documentation
+ *              files (the "Software"), to deal in the Software without
+ *              restriction, including without limitation the rights to use,
+ *              copy, modify, merge, publish, distribute, sublicense, and/or
+ *              sell copies of the Software, and to permit persons to whom the
+ *              Software is furnished to do so, subject to the following
+ *              conditions:                                                   @n
+ *                                                                            @n
+ *              The above copyright notice and this permission notice shall be
+ *              included in all´copies or substantial portions of the
+ *              Software.                                                     @n
+ *                                                                            @n
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *              EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ *              OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *              NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ *              HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ *              WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *              FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *              OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+ */
+
+#ifndef _TIMEBASE_H_
+#define _TIMEBASE_H_
+
+#include "..\\system.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  CPU-cycles per microsecond.
+ */
+#define TIMEBASE_CYCLES_PER_US          (F_CPU / 1000000UL)
+
+/**
+ *  Microseconds between two overflows of the Timer (4096 at 16 MHz).
+ */
+#define TIMEBASE_US_PER_OVERFLOW        (65536UL / TIMEBASE_CYCLES_PER_US)
+
+/**
+ *  Starts the Timer of the cycle-counter and its overflow interrupt. The
+ *  clock starts at 0.
+ *  @return     None.
+ *  @pre        None.
+ *  @post       The clock is running while the interrupts are enabled.
+ */
+void timebase_init(void);
+
+/**
+ *  Returns the time since timebase_init.
+ *  @return     Time in microseconds (modulo 2^32).
+ *  @pre        timebase_init has been called.
+ *  @post       None.
+ */
+uint32_t timebase_getMicros(void);
+
+/**
+ *  Sets the function that is called by the overflow interrupt.
+ *  @param      overflowCallback: Function to call or NULL for none. It is
+ *                                called with disabled interrupts.
+ *  @return     None.
+ *  @pre        timebase_init has been called.
+ *  @post       None.
+ */
+void timebase_setOverflowCallback(void (*overflowCallback)(void));
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* _TIMEBASE_H_ */